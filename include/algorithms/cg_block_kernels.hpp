@@ -0,0 +1,209 @@
+#pragma once
+
+#include "algorithms/cg_kernels.hpp"
+#include <stdexcept>
+
+// ==============================================================================
+//  Block (multi-RHS) kernels
+//
+//  k vectors are stored as an n x k row-major block (PrecisionTraits<T>::
+//  block_type), so the k entries of one unknown are contiguous. The sparse
+//  matrix-block product (SpMM) reads each matrix value and column index once
+//  and applies it to all k columns. Column j of every kernel performs the
+//  same operations in the same order as the single-vector kernel of
+//  cg_kernels.hpp, and column reductions use the same deterministic chunking
+//  (bailey_blas::reduce_many), so a column of a block solve reproduces the
+//  corresponding single-vector solve.
+// ==============================================================================
+
+namespace algorithms::kernels {
+
+/// Largest number of columns accepted by the SpMM kernels
+inline constexpr Eigen::Index max_block_columns = 64;
+
+/// One row of a block product, full CSR storage: out[j] = sum_l a(i,l) P(l,j)
+template<typename T, typename V, typename BlockType>
+inline void block_row(const Eigen::SparseMatrix<V, Eigen::RowMajor>& A, const BlockType& P,
+                      Eigen::Index i, T* out) {
+    const Eigen::Index k = P.cols();
+    const auto* outer = A.outerIndexPtr();
+    const auto* inner = A.innerIndexPtr();
+    const V* values = A.valuePtr();
+
+    for (Eigen::Index j = 0; j < k; ++j) {
+        out[j] = T(0.0);
+    }
+    for (auto e = outer[i]; e < outer[i + 1]; ++e) {
+        const V a = values[e];
+        const T* prow = P.data() + static_cast<Eigen::Index>(inner[e]) * k;
+        for (Eigen::Index j = 0; j < k; ++j) {
+            out[j] += scaled<T>(a, prow[j]);
+        }
+    }
+}
+
+/// One row of a block product, symmetric storage (same order as symmetric_row)
+template<typename T, typename V, typename BlockType>
+inline void block_row(const bailey::SymmetricCsrMatrix<V>& A, const BlockType& P,
+                      Eigen::Index i, T* out) {
+    const Eigen::Index k = P.cols();
+    const int* upper_outer = A.upperOuter();
+    const int* upper_inner = A.upperInner();
+    const int* lower_outer = A.lowerOuter();
+    const int* lower_inner = A.lowerInner();
+    const int* lower_pos = A.lowerPos();
+    const V* values = A.values();
+
+    for (Eigen::Index j = 0; j < k; ++j) {
+        out[j] = T(0.0);
+    }
+    for (int e = lower_outer[i]; e < lower_outer[i + 1]; ++e) {
+        const V a = values[lower_pos[e]];
+        const T* prow = P.data() + static_cast<Eigen::Index>(lower_inner[e]) * k;
+        for (Eigen::Index j = 0; j < k; ++j) {
+            out[j] += scaled<T>(a, prow[j]);
+        }
+    }
+    for (int e = upper_outer[i]; e < upper_outer[i + 1]; ++e) {
+        const V a = values[e];
+        const T* prow = P.data() + static_cast<Eigen::Index>(upper_inner[e]) * k;
+        for (Eigen::Index j = 0; j < k; ++j) {
+            out[j] += scaled<T>(a, prow[j]);
+        }
+    }
+}
+
+/// Row-parallel sparse matrix-block product W = A * P
+///
+/// @param A Sparse matrix (full CSR or symmetric storage, values T or double)
+/// @param P Input block, n x k with k <= max_block_columns
+/// @param W Output block, must already be n x k
+template<typename T, typename MatrixType>
+void spmm(
+    const MatrixType& A,
+    const typename bailey::PrecisionTraits<T>::block_type& P,
+    typename bailey::PrecisionTraits<T>::block_type& W
+) {
+    if (P.cols() > max_block_columns) {
+        throw std::runtime_error("spmm: too many columns");
+    }
+    eigen_assert(W.rows() == A.rows() && W.cols() == P.cols());
+
+    #pragma omp parallel for schedule(dynamic, 64)
+    for (Eigen::Index i = 0; i < A.rows(); ++i) {
+        block_row<T>(A, P, i, W.data() + i * W.cols());
+    }
+}
+
+/// Fused SpMM and column dot products: W = A * P, out[j] = P(:,j)·W(:,j)
+template<typename T, typename MatrixType>
+void spmm_dot(
+    const MatrixType& A,
+    const typename bailey::PrecisionTraits<T>::block_type& P,
+    typename bailey::PrecisionTraits<T>::block_type& W,
+    bailey_blas::ReduceScratch<T>& scratch,
+    T* out
+) {
+    if (P.cols() > max_block_columns) {
+        throw std::runtime_error("spmm_dot: too many columns");
+    }
+    eigen_assert(W.rows() == A.rows() && W.cols() == P.cols());
+    const Eigen::Index k = P.cols();
+
+    bailey_blas::reduce_many<T>(A.rows(), k, scratch, out,
+        [&](std::size_t begin, std::size_t end, Accumulator<T>* acc) {
+            for (std::size_t i = begin; i < end; ++i) {
+                T* wrow = W.data() + i * k;
+                const T* prow = P.data() + i * k;
+                block_row<T>(A, P, i, wrow);
+                for (Eigen::Index j = 0; j < k; ++j) {
+                    acc[j].add(prow[j] * wrow[j]);
+                }
+            }
+        });
+}
+
+/// Column dot products out[j] = X(:,j)·Y(:,j)
+template<typename T>
+void block_dot(
+    const typename bailey::PrecisionTraits<T>::block_type& X,
+    const typename bailey::PrecisionTraits<T>::block_type& Y,
+    bailey_blas::ReduceScratch<T>& scratch,
+    T* out
+) {
+    const Eigen::Index k = X.cols();
+    bailey_blas::reduce_many<T>(X.rows(), k, scratch, out,
+        [&](std::size_t begin, std::size_t end, Accumulator<T>* acc) {
+            for (std::size_t i = begin; i < end; ++i) {
+                for (Eigen::Index j = 0; j < k; ++j) {
+                    acc[j].add(X(i, j) * Y(i, j));
+                }
+            }
+        });
+}
+
+/// Column-wise CG update X += alpha_j P, R -= alpha_j W, out[j] = R(:,j)·R(:,j)
+///
+/// A column with alpha_j = 0 is left unchanged (used for converged RHS).
+template<typename T>
+void block_cg_update(
+    const T* alpha,
+    const typename bailey::PrecisionTraits<T>::block_type& P,
+    const typename bailey::PrecisionTraits<T>::block_type& W,
+    typename bailey::PrecisionTraits<T>::block_type& X,
+    typename bailey::PrecisionTraits<T>::block_type& R,
+    bailey_blas::ReduceScratch<T>& scratch,
+    T* out
+) {
+    const Eigen::Index k = R.cols();
+    bailey_blas::reduce_many<T>(R.rows(), k, scratch, out,
+        [&](std::size_t begin, std::size_t end, Accumulator<T>* acc) {
+            for (std::size_t i = begin; i < end; ++i) {
+                for (Eigen::Index j = 0; j < k; ++j) {
+                    X(i, j) += alpha[j] * P(i, j);
+                    R(i, j) -= alpha[j] * W(i, j);
+                    acc[j].add(R(i, j) * R(i, j));
+                }
+            }
+        });
+}
+
+/// Column-wise search direction update P(:,j) = R(:,j) + beta_j P(:,j)
+template<typename T>
+void block_xpby(
+    const typename bailey::PrecisionTraits<T>::block_type& R,
+    const T* beta,
+    typename bailey::PrecisionTraits<T>::block_type& P
+) {
+    const Eigen::Index k = P.cols();
+
+    #pragma omp parallel for schedule(static)
+    for (Eigen::Index i = 0; i < P.rows(); ++i) {
+        for (Eigen::Index j = 0; j < k; ++j) {
+            P(i, j) = R(i, j) + beta[j] * P(i, j);
+        }
+    }
+}
+
+/// Fused block difference and column norms: D = X - Y, out[j] = D(:,j)·D(:,j)
+template<typename T>
+void block_diff_dot(
+    const typename bailey::PrecisionTraits<T>::block_type& X,
+    const typename bailey::PrecisionTraits<T>::block_type& Y,
+    typename bailey::PrecisionTraits<T>::block_type& D,
+    bailey_blas::ReduceScratch<T>& scratch,
+    T* out
+) {
+    const Eigen::Index k = D.cols();
+    bailey_blas::reduce_many<T>(D.rows(), k, scratch, out,
+        [&](std::size_t begin, std::size_t end, Accumulator<T>* acc) {
+            for (std::size_t i = begin; i < end; ++i) {
+                for (Eigen::Index j = 0; j < k; ++j) {
+                    D(i, j) = X(i, j) - Y(i, j);
+                    acc[j].add(D(i, j) * D(i, j));
+                }
+            }
+        });
+}
+
+} // namespace algorithms::kernels
@@ -0,0 +1,82 @@
+#pragma once
+
+#include "algorithms/conjugate_gradient.hpp"
+#include "algorithms/pipelined_cg.hpp"
+#include "algorithms/sstep_cg.hpp"
+#include "algorithms/multi_rhs_cg.hpp"
+#include "bailey/symmetric_csr.hpp"
+
+// ==============================================================================
+//  Explicit instantiations of the CG solvers
+//
+//  Including this header declares the solvers below as explicitly
+//  instantiated (extern template), so the including translation unit does
+//  not compile them itself. Their definitions come from one translation unit
+//  per precision (src/instantiations/cg_<key>.cpp, CMake target
+//  cg_instances). Those files build in parallel and are rebuilt only when a
+//  solver header or that precision changes, not when the program using them
+//  does.
+//
+//  Covered for each precision T: conjugateGradient, pipelinedConjugateGradient,
+//  sstepConjugateGradient and multiRhsConjugateGradient (with and without a
+//  workspace argument) on full CSR and symmetric storage, with values in T
+//  or in double. Other combinations are still instantiated implicitly.
+// ==============================================================================
+
+namespace algorithms::instances {
+
+template<typename T> using Vector = typename bailey::PrecisionTraits<T>::vector_type;
+template<typename T> using Block = typename bailey::PrecisionTraits<T>::block_type;
+template<typename V> using Csr = Eigen::SparseMatrix<V, Eigen::RowMajor>;
+template<typename V> using Symmetric = bailey::SymmetricCsrMatrix<V>;
+
+} // namespace algorithms::instances
+
+/// Explicit instantiation declarations (EXTERN = extern) or definitions
+/// (EXTERN empty) of all covered solvers for precision T and matrix type M
+#define BAILEY_CG_SOLVERS(EXTERN, T, M)                                                                    \
+    EXTERN template CGResult<T> conjugateGradient<T, M>(                                                   \
+        const M&, const instances::Vector<T>&, instances::Vector<T>&, const instances::Vector<T>&,         \
+        int, double, CGWorkspace<T>&, const DiagnosticsPolicy&, const CheckpointPolicy<T>&);               \
+    EXTERN template CGResult<T> conjugateGradient<T, M>(                                                   \
+        const M&, const instances::Vector<T>&, instances::Vector<T>&, const instances::Vector<T>&,         \
+        int, double, const DiagnosticsPolicy&, const CheckpointPolicy<T>&);                                \
+    EXTERN template CGResult<T> pipelinedConjugateGradient<T, M>(                                          \
+        const M&, const instances::Vector<T>&, instances::Vector<T>&, const instances::Vector<T>&,         \
+        int, double, PipelinedCGWorkspace<T>&, const DiagnosticsPolicy&);                                  \
+    EXTERN template CGResult<T> pipelinedConjugateGradient<T, M>(                                          \
+        const M&, const instances::Vector<T>&, instances::Vector<T>&, const instances::Vector<T>&,         \
+        int, double, const DiagnosticsPolicy&);                                                            \
+    EXTERN template CGResult<T> sstepConjugateGradient<T, M>(                                              \
+        const M&, const instances::Vector<T>&, instances::Vector<T>&, const instances::Vector<T>&,         \
+        int, int, double, SStepCGWorkspace<T>&, const DiagnosticsPolicy&);                                 \
+    EXTERN template CGResult<T> sstepConjugateGradient<T, M>(                                              \
+        const M&, const instances::Vector<T>&, instances::Vector<T>&, const instances::Vector<T>&,         \
+        int, int, double, const DiagnosticsPolicy&);                                                       \
+    EXTERN template std::vector<CGResult<T>> multiRhsConjugateGradient<T, M>(                              \
+        const M&, const instances::Block<T>&, instances::Block<T>&, const instances::Block<T>&,            \
+        int, double, MultiRhsCGWorkspace<T>&, const DiagnosticsPolicy&);                                   \
+    EXTERN template std::vector<CGResult<T>> multiRhsConjugateGradient<T, M>(                              \
+        const M&, const instances::Block<T>&, instances::Block<T>&, const instances::Block<T>&,            \
+        int, double, const DiagnosticsPolicy&);
+
+/// All covered matrix types for a Bailey precision T (values in T or double)
+#define BAILEY_CG_INSTANCES(EXTERN, T)                                  \
+    BAILEY_CG_SOLVERS(EXTERN, T, instances::Csr<T>)                     \
+    BAILEY_CG_SOLVERS(EXTERN, T, instances::Symmetric<T>)               \
+    BAILEY_CG_SOLVERS(EXTERN, T, instances::Csr<double>)                \
+    BAILEY_CG_SOLVERS(EXTERN, T, instances::Symmetric<double>)
+
+/// All covered matrix types for double (native values are double values)
+#define BAILEY_CG_INSTANCES_DOUBLE(EXTERN)                              \
+    BAILEY_CG_SOLVERS(EXTERN, double, instances::Csr<double>)           \
+    BAILEY_CG_SOLVERS(EXTERN, double, instances::Symmetric<double>)
+
+namespace algorithms {
+
+BAILEY_CG_INSTANCES_DOUBLE(extern)
+BAILEY_CG_INSTANCES(extern, bailey::DDNumber)
+BAILEY_CG_INSTANCES(extern, bailey::DQNumber)
+BAILEY_CG_INSTANCES(extern, bailey::QXNumber)
+
+} // namespace algorithms
@@ -0,0 +1,482 @@
+#pragma once
+
+#include "bailey/precision_traits.hpp"
+#include "bailey/bailey_blas.hpp"
+#include "bailey/symmetric_csr.hpp"
+#include <Eigen/Sparse>
+#include <type_traits>
+#include <array>
+#include <vector>
+#include <stdexcept>
+
+// ==============================================================================
+//  CG vector/matrix kernels
+//
+//  Row-partitioned CSR SpMV, axpy-type updates and dot products, parallelized
+//  with OpenMP when available (pragmas are ignored otherwise). Reductions go
+//  through bailey_blas::reduce, whose fixed chunking and pairwise combination
+//  order make results bitwise identical for any thread count, including
+//  serial builds.
+//
+//  For the Fortran-backed types, dot, axpy and the CSR SpMV hand whole
+//  chunks to the array-level wrapper routines (bailey_blas::VectorKernels)
+//  instead of calling Fortran once per flop. The results are unchanged as long
+//  as the wrappers are compiled without value-changing flags (the Dockerfile
+//  uses -O2; no -ffast-math, no -ffp-contract=fast with FMA targets).
+// ==============================================================================
+
+namespace algorithms::kernels {
+
+using bailey_blas::Accumulator;
+using bailey_blas::VectorKernels;
+
+/// Dot product x·y with deterministic parallel reduction
+template<typename T>
+T dot(
+    const typename bailey::PrecisionTraits<T>::vector_type& x,
+    const typename bailey::PrecisionTraits<T>::vector_type& y
+) {
+    return bailey_blas::reduce<T>(x.size(), [&](std::size_t begin, std::size_t end, Accumulator<T>& acc) {
+        if constexpr (VectorKernels<T>::available) {
+            acc.sum = VectorKernels<T>::dot(end - begin, x.data() + begin, y.data() + begin);
+        } else {
+            for (std::size_t i = begin; i < end; ++i) {
+                acc.add(x[i] * y[i]);
+            }
+        }
+    });
+}
+
+/// Row-parallel CSR sparse matrix-vector product w = A * p
+///
+/// @param A Sparse matrix (compressed CSR)
+/// @param p Input vector
+/// @param w Output vector, must already have A.rows() entries
+template<typename T>
+void spmv(
+    const typename bailey::PrecisionTraits<T>::matrix_type& A,
+    const typename bailey::PrecisionTraits<T>::vector_type& p,
+    typename bailey::PrecisionTraits<T>::vector_type& w
+) {
+    static_assert(bailey::PrecisionTraits<T>::matrix_type::IsRowMajor,
+                  "spmv requires CSR (row-major) storage");
+    eigen_assert(A.isCompressed() && w.size() == A.rows());
+
+    const auto* outer = A.outerIndexPtr();
+    const auto* inner = A.innerIndexPtr();
+    const T* values = A.valuePtr();
+
+    if constexpr (VectorKernels<T>::available) {
+        bailey_blas::for_chunks(A.rows(), [&](std::size_t begin, std::size_t end) {
+            VectorKernels<T>::spmv_csr(static_cast<int>(begin), static_cast<int>(end),
+                                       outer, inner, values, p.data(), w.data());
+        });
+        return;
+    }
+
+    #pragma omp parallel for schedule(dynamic, 64)
+    for (Eigen::Index i = 0; i < A.rows(); ++i) {
+        T sum = T(0.0);
+        for (auto k = outer[i]; k < outer[i + 1]; ++k) {
+            sum += values[k] * p[inner[k]];
+        }
+        w[i] = sum;
+    }
+}
+
+/// Fused CSR sparse matrix-vector product and dot product
+///
+/// Computes w = A * p and returns p·w in a single sweep over the rows,
+/// so p and w are not streamed a second time for the CG step-size
+/// denominator. A must be in compressed row-major (CSR) storage, which is
+/// what PrecisionTraits<T>::matrix_type provides.
+///
+/// @param A Sparse matrix (compressed CSR)
+/// @param p Input vector
+/// @param w Output vector, must already have A.rows() entries
+/// @return p·(A p)
+template<typename T>
+T spmv_dot(
+    const typename bailey::PrecisionTraits<T>::matrix_type& A,
+    const typename bailey::PrecisionTraits<T>::vector_type& p,
+    typename bailey::PrecisionTraits<T>::vector_type& w
+) {
+    static_assert(bailey::PrecisionTraits<T>::matrix_type::IsRowMajor,
+                  "spmv_dot requires CSR (row-major) storage");
+    eigen_assert(A.isCompressed() && w.size() == A.rows());
+
+    const auto* outer = A.outerIndexPtr();
+    const auto* inner = A.innerIndexPtr();
+    const T* values = A.valuePtr();
+
+    return bailey_blas::reduce<T>(A.rows(), [&](std::size_t begin, std::size_t end, Accumulator<T>& acc) {
+        if constexpr (VectorKernels<T>::available) {
+            VectorKernels<T>::spmv_csr(static_cast<int>(begin), static_cast<int>(end),
+                                       outer, inner, values, p.data(), w.data());
+            acc.sum = VectorKernels<T>::dot(end - begin, p.data() + begin, w.data() + begin);
+            return;
+        }
+        for (std::size_t i = begin; i < end; ++i) {
+            T sum = T(0.0);
+            for (auto k = outer[i]; k < outer[i + 1]; ++k) {
+                sum += values[k] * p[inner[k]];
+            }
+            w[i] = sum;
+            acc.add(p[i] * sum);
+        }
+    });
+}
+
+/// Product of a stored matrix value and a vector entry
+///
+/// Values stored in double (mixed storage) are not promoted to T first:
+/// mul_double multiplies by the plain double directly, which gives the same
+/// result as T(a) * x at a lower cost.
+template<typename T, typename V>
+inline T scaled(const V& a, const T& x) {
+    if constexpr (std::is_same_v<V, T>) {
+        return a * x;
+    } else {
+        static_assert(std::is_same_v<V, double>, "matrix values must be T or double");
+        return mul_double(x, a);
+    }
+}
+
+/// Row-parallel CSR SpMV w = A * p with double matrix values (mixed storage)
+///
+/// Values stay in double and are multiplied into precision T on the fly,
+/// so the matrix takes 8 bytes per nonzero regardless of T.
+template<typename T, typename = std::enable_if_t<!std::is_same_v<T, double>>>
+void spmv(
+    const Eigen::SparseMatrix<double, Eigen::RowMajor>& A,
+    const typename bailey::PrecisionTraits<T>::vector_type& p,
+    typename bailey::PrecisionTraits<T>::vector_type& w
+) {
+    eigen_assert(A.isCompressed() && w.size() == A.rows());
+
+    const auto* outer = A.outerIndexPtr();
+    const auto* inner = A.innerIndexPtr();
+    const double* values = A.valuePtr();
+
+    if constexpr (VectorKernels<T>::available) {
+        bailey_blas::for_chunks(A.rows(), [&](std::size_t begin, std::size_t end) {
+            VectorKernels<T>::spmv_csr(static_cast<int>(begin), static_cast<int>(end),
+                                       outer, inner, values, p.data(), w.data());
+        });
+        return;
+    }
+
+    #pragma omp parallel for schedule(dynamic, 64)
+    for (Eigen::Index i = 0; i < A.rows(); ++i) {
+        T sum = T(0.0);
+        for (auto k = outer[i]; k < outer[i + 1]; ++k) {
+            sum += scaled<T>(values[k], p[inner[k]]);
+        }
+        w[i] = sum;
+    }
+}
+
+/// Fused SpMV and dot product with double matrix values: w = A * p, returns p·w
+template<typename T, typename = std::enable_if_t<!std::is_same_v<T, double>>>
+T spmv_dot(
+    const Eigen::SparseMatrix<double, Eigen::RowMajor>& A,
+    const typename bailey::PrecisionTraits<T>::vector_type& p,
+    typename bailey::PrecisionTraits<T>::vector_type& w
+) {
+    eigen_assert(A.isCompressed() && w.size() == A.rows());
+
+    const auto* outer = A.outerIndexPtr();
+    const auto* inner = A.innerIndexPtr();
+    const double* values = A.valuePtr();
+
+    return bailey_blas::reduce<T>(A.rows(), [&](std::size_t begin, std::size_t end, Accumulator<T>& acc) {
+        if constexpr (VectorKernels<T>::available) {
+            VectorKernels<T>::spmv_csr(static_cast<int>(begin), static_cast<int>(end),
+                                       outer, inner, values, p.data(), w.data());
+            acc.sum = VectorKernels<T>::dot(end - begin, p.data() + begin, w.data() + begin);
+            return;
+        }
+        for (std::size_t i = begin; i < end; ++i) {
+            T sum = T(0.0);
+            for (auto k = outer[i]; k < outer[i + 1]; ++k) {
+                sum += scaled<T>(values[k], p[inner[k]]);
+            }
+            w[i] = sum;
+            acc.add(p[i] * sum);
+        }
+    });
+}
+
+/// One row of a symmetric-storage product: sum_j a(i,j) p[j] in ascending j
+///
+/// Lower-triangle entries come from the transposed index, the diagonal and
+/// upper entries from the stored row, so the order matches a full CSR row.
+template<typename T, typename V, typename VectorType>
+inline T symmetric_row(const bailey::SymmetricCsrMatrix<V>& A, const VectorType& p, Eigen::Index i) {
+    const int* upper_outer = A.upperOuter();
+    const int* upper_inner = A.upperInner();
+    const int* lower_outer = A.lowerOuter();
+    const int* lower_inner = A.lowerInner();
+    const int* lower_pos = A.lowerPos();
+    const V* values = A.values();
+
+    T sum = T(0.0);
+    for (int k = lower_outer[i]; k < lower_outer[i + 1]; ++k) {
+        sum += scaled<T>(values[lower_pos[k]], p[lower_inner[k]]);
+    }
+    for (int k = upper_outer[i]; k < upper_outer[i + 1]; ++k) {
+        sum += scaled<T>(values[k], p[upper_inner[k]]);
+    }
+    return sum;
+}
+
+/// Row-parallel SpMV w = A * p with symmetric (upper-triangle) storage
+///
+/// Values of type V (T, or double for mixed storage) are multiplied in
+/// precision T on the fly.
+template<typename T, typename V>
+void spmv(
+    const bailey::SymmetricCsrMatrix<V>& A,
+    const typename bailey::PrecisionTraits<T>::vector_type& p,
+    typename bailey::PrecisionTraits<T>::vector_type& w
+) {
+    eigen_assert(w.size() == A.rows());
+
+    #pragma omp parallel for schedule(dynamic, 64)
+    for (Eigen::Index i = 0; i < A.rows(); ++i) {
+        w[i] = symmetric_row<T>(A, p, i);
+    }
+}
+
+/// Fused symmetric-storage SpMV and dot product: w = A * p, returns p·w
+template<typename T, typename V>
+T spmv_dot(
+    const bailey::SymmetricCsrMatrix<V>& A,
+    const typename bailey::PrecisionTraits<T>::vector_type& p,
+    typename bailey::PrecisionTraits<T>::vector_type& w
+) {
+    eigen_assert(w.size() == A.rows());
+
+    return bailey_blas::reduce<T>(A.rows(), [&](std::size_t begin, std::size_t end, Accumulator<T>& acc) {
+        for (std::size_t i = begin; i < end; ++i) {
+            T sum = symmetric_row<T>(A, p, i);
+            w[i] = sum;
+            acc.add(p[i] * sum);
+        }
+    });
+}
+
+/// AXPY update y = y + alpha * x
+template<typename T>
+void axpy(
+    const T& alpha,
+    const typename bailey::PrecisionTraits<T>::vector_type& x,
+    typename bailey::PrecisionTraits<T>::vector_type& y
+) {
+    if constexpr (VectorKernels<T>::available) {
+        bailey_blas::for_chunks(y.size(), [&](std::size_t begin, std::size_t end) {
+            VectorKernels<T>::axpy(end - begin, alpha, x.data() + begin, y.data() + begin);
+        });
+        return;
+    }
+
+    #pragma omp parallel for schedule(static)
+    for (Eigen::Index i = 0; i < y.size(); ++i) {
+        y[i] += alpha * x[i];
+    }
+}
+
+/// Search direction update p = r + beta * p
+template<typename T>
+void xpby(
+    const typename bailey::PrecisionTraits<T>::vector_type& r,
+    const T& beta,
+    typename bailey::PrecisionTraits<T>::vector_type& p
+) {
+    #pragma omp parallel for schedule(static)
+    for (Eigen::Index i = 0; i < p.size(); ++i) {
+        p[i] = r[i] + beta * p[i];
+    }
+}
+
+/// Fused residual update and squared norm
+///
+/// Computes r = r - alpha * w and returns r·r in the same sweep.
+///
+/// @param alpha Step size
+/// @param w Vector to subtract (A p in CG)
+/// @param r Vector updated in place
+/// @return Updated r·r
+template<typename T>
+T axpy_dot(
+    const T& alpha,
+    const typename bailey::PrecisionTraits<T>::vector_type& w,
+    typename bailey::PrecisionTraits<T>::vector_type& r
+) {
+    return bailey_blas::reduce<T>(r.size(), [&](std::size_t begin, std::size_t end, Accumulator<T>& acc) {
+        for (std::size_t i = begin; i < end; ++i) {
+            r[i] -= alpha * w[i];
+            acc.add(r[i] * r[i]);
+        }
+    });
+}
+
+/// Fused vector difference and squared norm
+///
+/// Computes d = a - b and returns d·d in the same sweep
+/// (used for the error vector x_true - x).
+///
+/// @return Updated d·d
+template<typename T>
+T diff_dot(
+    const typename bailey::PrecisionTraits<T>::vector_type& a,
+    const typename bailey::PrecisionTraits<T>::vector_type& b,
+    typename bailey::PrecisionTraits<T>::vector_type& d
+) {
+    return bailey_blas::reduce<T>(d.size(), [&](std::size_t begin, std::size_t end, Accumulator<T>& acc) {
+        for (std::size_t i = begin; i < end; ++i) {
+            d[i] = a[i] - b[i];
+            acc.add(d[i] * d[i]);
+        }
+    });
+}
+
+/// Fused vector update of pipelined CG (Ghysels-Vanroose) with its reduction
+///
+/// In one sweep: z = q + beta z, s = w + beta s, p = r + beta p,
+/// x = x + alpha p, r = r - alpha s, w = w - alpha z, and returns the
+/// next iteration's (r·r, w·r) from a single combined reduction.
+///
+/// @return {r·r, w·r} of the updated vectors
+template<typename T>
+std::array<T, 2> pipelined_update(
+    const T& alpha,
+    const T& beta,
+    const typename bailey::PrecisionTraits<T>::vector_type& q,
+    typename bailey::PrecisionTraits<T>::vector_type& z,
+    typename bailey::PrecisionTraits<T>::vector_type& s,
+    typename bailey::PrecisionTraits<T>::vector_type& p,
+    typename bailey::PrecisionTraits<T>::vector_type& x,
+    typename bailey::PrecisionTraits<T>::vector_type& r,
+    typename bailey::PrecisionTraits<T>::vector_type& w
+) {
+    return bailey_blas::reduce_multi<T, 2>(r.size(),
+        [&](std::size_t begin, std::size_t end, std::array<Accumulator<T>, 2>& acc) {
+            for (std::size_t i = begin; i < end; ++i) {
+                const T zi = T(q[i]) + beta * z[i];
+                const T si = T(w[i]) + beta * s[i];
+                const T pi = T(r[i]) + beta * p[i];
+                z[i] = zi;
+                s[i] = si;
+                p[i] = pi;
+                x[i] += alpha * pi;
+                const T ri = T(r[i]) - alpha * si;
+                const T wi = T(w[i]) - alpha * zi;
+                r[i] = ri;
+                w[i] = wi;
+                acc[0].add(ri * ri);
+                acc[1].add(wi * ri);
+            }
+        });
+}
+
+/// Largest number of vectors accepted by gram() and block_combine()
+inline constexpr std::size_t max_block_vectors = 64;
+
+/// Gram matrix G = Y^T Y of a block of vectors with a single reduction
+///
+/// Each element of the block is loaded once and all d(d+1)/2 products of the
+/// upper triangle are accumulated in the same sweep (one reduce_many), so a
+/// block of d vectors costs one synchronization instead of d(d+1)/2 dot
+/// products.
+///
+/// @param Y Block of d vectors of equal length (d <= max_block_vectors)
+/// @param scratch Reduction scratch (reused across calls)
+/// @param packed Upper triangle of G, row by row (resized to d(d+1)/2)
+/// @param G Full symmetric Gram matrix, row-major d x d (resized)
+template<typename T>
+void gram(
+    const std::vector<typename bailey::PrecisionTraits<T>::vector_type>& Y,
+    bailey_blas::ReduceScratch<T>& scratch,
+    std::vector<T>& packed,
+    std::vector<T>& G
+) {
+    const std::size_t d = Y.size();
+    if (d == 0 || d > max_block_vectors) {
+        throw std::runtime_error("gram: block size out of range");
+    }
+    const std::size_t m = d * (d + 1) / 2;
+    packed.resize(m);
+    G.resize(d * d);
+
+    bailey_blas::reduce_many<T>(Y[0].size(), m, scratch, packed.data(),
+        [&](std::size_t begin, std::size_t end, Accumulator<T>* acc) {
+            std::array<T, max_block_vectors> yi;
+            for (std::size_t i = begin; i < end; ++i) {
+                for (std::size_t j = 0; j < d; ++j) {
+                    yi[j] = T(Y[j][i]);
+                }
+                std::size_t k = 0;
+                for (std::size_t j = 0; j < d; ++j) {
+                    for (std::size_t l = j; l < d; ++l) {
+                        acc[k++].add(yi[j] * yi[l]);
+                    }
+                }
+            }
+        });
+
+    std::size_t k = 0;
+    for (std::size_t j = 0; j < d; ++j) {
+        for (std::size_t l = j; l < d; ++l) {
+            G[j * d + l] = packed[k];
+            G[l * d + j] = packed[k];
+            ++k;
+        }
+    }
+}
+
+/// Combine a block of vectors with three coefficient vectors in one sweep
+///
+/// Computes x = x + Y cx, r = Y cr, p = Y cp. r and p may be members of Y:
+/// every element of the block is read before any output at the same index
+/// is written.
+template<typename T>
+void block_combine(
+    const std::vector<typename bailey::PrecisionTraits<T>::vector_type>& Y,
+    const std::vector<T>& cx,
+    const std::vector<T>& cr,
+    const std::vector<T>& cp,
+    typename bailey::PrecisionTraits<T>::vector_type& x,
+    typename bailey::PrecisionTraits<T>::vector_type& r,
+    typename bailey::PrecisionTraits<T>::vector_type& p
+) {
+    const std::size_t d = Y.size();
+    if (d == 0 || d > max_block_vectors) {
+        throw std::runtime_error("block_combine: block size out of range");
+    }
+
+    #pragma omp parallel for schedule(static)
+    for (Eigen::Index i = 0; i < x.size(); ++i) {
+        std::array<T, max_block_vectors> yi;
+        for (std::size_t j = 0; j < d; ++j) {
+            yi[j] = T(Y[j][i]);
+        }
+        T xi = T(x[i]);
+        T ri = T(0.0);
+        T pi = T(0.0);
+        for (std::size_t j = 0; j < d; ++j) {
+            xi += cx[j] * yi[j];
+            ri += cr[j] * yi[j];
+            pi += cp[j] * yi[j];
+        }
+        x[i] = xi;
+        r[i] = ri;
+        p[i] = pi;
+    }
+}
+
+} // namespace algorithms::kernels
+
+#ifdef BAILEY_DD_SOA
+#include "algorithms/cg_kernels_dd_soa.hpp"
+#endif
@@ -0,0 +1,392 @@
+#pragma once
+
+// This file is only included from cg_kernels.hpp when BAILEY_DD_SOA is defined
+
+#include "bailey/dd_vector.hpp"
+#include "bailey/dd_inline.hpp"
+#include "bailey/dd_simd.hpp"
+
+// ==============================================================================
+//  CG kernels for structure-of-arrays DD vectors (bailey::DDVector)
+//
+//  Specializations of the generic kernels for T = DDNumber that work directly
+//  on the split hi/lo limb arrays with the inline DD kernels. Reductions keep
+//  `lanes` independent DD accumulators per chunk, so consecutive elements map
+//  to SIMD lanes (hi limbs in one register, lo limbs in another) under
+//  -march=native; the lane partials are folded in fixed order, keeping results
+//  independent of the thread count. Element-wise results are bit-identical to
+//  DDFUN; reductions sum in a different (fixed) order than the AoS kernels.
+//
+//  dot, axpy/xpby and the CSR SpMV rows additionally go through the explicit
+//  AVX2/AVX-512 kernels of bailey/dd_simd.hpp, selected at runtime. The dot
+//  keeps the same 8-lane order and SpMV rows the same 4-lane order on every
+//  ISA (scalar fallback included). The double-valued (mixed storage) SpMV
+//  uses the same lanes and matches a DD matrix holding the same values bit
+//  for bit; symmetric-storage rows are summed in the same lanes as well.
+// ==============================================================================
+
+namespace algorithms::kernels {
+
+namespace dd_soa {
+
+/// Independent accumulators per reduction chunk (one AVX-512 register of hi limbs)
+inline constexpr std::size_t lanes = 8;
+static_assert(lanes == bailey::dd_simd::lanes, "SIMD dot must use the scalar lane layout");
+static_assert(sizeof(bailey::DDNumber) == 2 * sizeof(double), "DDNumber must be two packed limbs");
+
+/// Reduce DD terms over [begin, end) into acc using `lanes` interleaved accumulators
+///
+/// @param block Callable (begin, end, sh, sl) that accumulates a leading run of
+///              elements into the lanes and returns its length (a multiple of lanes)
+/// @param term  Callable (i, hi&, lo&) producing the DD term of element i
+template<typename Block, typename Term>
+inline void lane_sum(std::size_t begin, std::size_t end, Block block, Term term,
+                     bailey_blas::Accumulator<bailey::DDNumber>& acc) {
+    namespace k = bailey::dd_kernels;
+
+    double sh[lanes] = {};
+    double sl[lanes] = {};
+
+    std::size_t i = begin + block(begin, end, sh, sl);
+    for (; i + lanes <= end; i += lanes) {
+        for (std::size_t l = 0; l < lanes; ++l) {
+            double th, tl;
+            term(i + l, th, tl);
+            k::add(sh[l], sl[l], th, tl, sh[l], sl[l]);
+        }
+    }
+    for (; i < end; ++i) {
+        double th, tl;
+        term(i, th, tl);
+        k::add(sh[0], sl[0], th, tl, sh[0], sl[0]);
+    }
+
+    for (std::size_t l = 1; l < lanes; ++l) {
+        k::add(sh[0], sl[0], sh[l], sl[l], sh[0], sl[0]);
+    }
+    acc.add(bailey::dd_from_limbs(sh[0], sl[0]));
+}
+
+template<typename Term>
+inline void lane_sum(std::size_t begin, std::size_t end, Term term,
+                     bailey_blas::Accumulator<bailey::DDNumber>& acc) {
+    lane_sum(begin, end, [](std::size_t, std::size_t, double*, double*) { return std::size_t{0}; },
+             term, acc);
+}
+
+/// One CSR row of A * p on split limbs
+inline void row_product(const int* outer, const int* inner, const bailey::DDNumber* values,
+                        const double* ph, const double* pl, std::size_t i,
+                        double& sh, double& sl) {
+    const int first = outer[i];
+    bailey::dd_simd::row_dot(reinterpret_cast<const double*>(values + first), inner + first,
+                             static_cast<std::size_t>(outer[i + 1] - first), ph, pl, sh, sl);
+}
+
+/// One CSR row of A * p with double matrix values (mixed storage)
+inline void row_product(const int* outer, const int* inner, const double* values,
+                        const double* ph, const double* pl, std::size_t i,
+                        double& sh, double& sl) {
+    const int first = outer[i];
+    bailey::dd_simd::row_dot_d(values + first, inner + first,
+                               static_cast<std::size_t>(outer[i + 1] - first), ph, pl, sh, sl);
+}
+
+/// DD term v * p[col] of a row product (same operand order as dd_simd::row_dot)
+inline void row_term(const bailey::DDNumber& v, const double* ph, const double* pl, int col,
+                     double& th, double& tl) {
+    bailey::dd_kernels::mul(v.dd[0], v.dd[1], ph[col], pl[col], th, tl);
+}
+
+/// DD term v * p[col] with a double matrix value (same operand order as dd_simd::row_dot_d)
+inline void row_term(double v, const double* ph, const double* pl, int col, double& th, double& tl) {
+    bailey::dd_kernels::mul_d(ph[col], pl[col], v, th, tl);
+}
+
+/// One symmetric-storage row of A * p on split limbs
+///
+/// The lower entries (transposed index) followed by the stored upper row are
+/// the columns of a full CSR row in ascending order; dd_simd::row_sum sums
+/// them in the lanes of row_dot, so results match full storage bit for bit.
+template<typename V>
+inline void symmetric_row_product(const bailey::SymmetricCsrMatrix<V>& A,
+                                  const double* ph, const double* pl, std::size_t i,
+                                  double& sh, double& sl) {
+    const int* lower_inner = A.lowerInner();
+    const int* lower_pos = A.lowerPos();
+    const int* upper_inner = A.upperInner();
+    const V* values = A.values();
+    const int lower_first = A.lowerOuter()[i];
+    const int upper_first = A.upperOuter()[i];
+    const std::size_t n_lower = static_cast<std::size_t>(A.lowerOuter()[i + 1] - lower_first);
+    const std::size_t n_upper = static_cast<std::size_t>(A.upperOuter()[i + 1] - upper_first);
+
+    bailey::dd_simd::row_sum(n_lower + n_upper, [&](std::size_t k, double& th, double& tl) {
+        if (k < n_lower) {
+            row_term(values[lower_pos[lower_first + k]], ph, pl, lower_inner[lower_first + k], th, tl);
+        } else {
+            const int pos = upper_first + static_cast<int>(k - n_lower);
+            row_term(values[pos], ph, pl, upper_inner[pos], th, tl);
+        }
+    }, sh, sl);
+}
+
+template<typename V>
+inline void symmetric_spmv(const bailey::SymmetricCsrMatrix<V>& A,
+                           const bailey::DDVector& p, bailey::DDVector& w) {
+    eigen_assert(w.size() == A.rows());
+
+    const double* ph = p.hi();
+    const double* pl = p.lo();
+    double* wh = w.hi();
+    double* wl = w.lo();
+
+    #pragma omp parallel for schedule(dynamic, 64)
+    for (Eigen::Index i = 0; i < A.rows(); ++i) {
+        symmetric_row_product(A, ph, pl, i, wh[i], wl[i]);
+    }
+}
+
+template<typename V>
+inline bailey::DDNumber symmetric_spmv_dot(const bailey::SymmetricCsrMatrix<V>& A,
+                                           const bailey::DDVector& p, bailey::DDVector& w) {
+    eigen_assert(w.size() == A.rows());
+
+    const double* ph = p.hi();
+    const double* pl = p.lo();
+    double* wh = w.hi();
+    double* wl = w.lo();
+
+    return bailey_blas::reduce<bailey::DDNumber>(A.rows(),
+        [&](std::size_t begin, std::size_t end, Accumulator<bailey::DDNumber>& acc) {
+            lane_sum(begin, end, [&](std::size_t i, double& th, double& tl) {
+                symmetric_row_product(A, ph, pl, i, wh[i], wl[i]);
+                bailey::dd_kernels::mul(ph[i], pl[i], wh[i], wl[i], th, tl);
+            }, acc);
+        });
+}
+
+} // namespace dd_soa
+
+template<>
+inline bailey::DDNumber dot<bailey::DDNumber>(const bailey::DDVector& x, const bailey::DDVector& y) {
+    const double* xh = x.hi();
+    const double* xl = x.lo();
+    const double* yh = y.hi();
+    const double* yl = y.lo();
+
+    return bailey_blas::reduce<bailey::DDNumber>(x.size(),
+        [&](std::size_t begin, std::size_t end, Accumulator<bailey::DDNumber>& acc) {
+            dd_soa::lane_sum(begin, end,
+                [&](std::size_t b, std::size_t e, double* sh, double* sl) {
+                    return bailey::dd_simd::dot_lanes(xh + b, xl + b, yh + b, yl + b, e - b, sh, sl);
+                },
+                [&](std::size_t i, double& th, double& tl) {
+                    bailey::dd_kernels::mul(xh[i], xl[i], yh[i], yl[i], th, tl);
+                }, acc);
+        });
+}
+
+template<>
+inline void spmv<bailey::DDNumber>(const bailey::DDTraits::matrix_type& A,
+                                   const bailey::DDVector& p, bailey::DDVector& w) {
+    eigen_assert(A.isCompressed() && w.size() == A.rows());
+
+    const int* outer = A.outerIndexPtr();
+    const int* inner = A.innerIndexPtr();
+    const bailey::DDNumber* values = A.valuePtr();
+    const double* ph = p.hi();
+    const double* pl = p.lo();
+    double* wh = w.hi();
+    double* wl = w.lo();
+
+    #pragma omp parallel for schedule(dynamic, 64)
+    for (Eigen::Index i = 0; i < A.rows(); ++i) {
+        dd_soa::row_product(outer, inner, values, ph, pl, i, wh[i], wl[i]);
+    }
+}
+
+template<>
+inline bailey::DDNumber spmv_dot<bailey::DDNumber>(const bailey::DDTraits::matrix_type& A,
+                                                   const bailey::DDVector& p, bailey::DDVector& w) {
+    eigen_assert(A.isCompressed() && w.size() == A.rows());
+
+    const int* outer = A.outerIndexPtr();
+    const int* inner = A.innerIndexPtr();
+    const bailey::DDNumber* values = A.valuePtr();
+    const double* ph = p.hi();
+    const double* pl = p.lo();
+    double* wh = w.hi();
+    double* wl = w.lo();
+
+    return bailey_blas::reduce<bailey::DDNumber>(A.rows(),
+        [&](std::size_t begin, std::size_t end, Accumulator<bailey::DDNumber>& acc) {
+            dd_soa::lane_sum(begin, end, [&](std::size_t i, double& th, double& tl) {
+                dd_soa::row_product(outer, inner, values, ph, pl, i, wh[i], wl[i]);
+                bailey::dd_kernels::mul(ph[i], pl[i], wh[i], wl[i], th, tl);
+            }, acc);
+        });
+}
+
+template<>
+inline void spmv<bailey::DDNumber>(const Eigen::SparseMatrix<double, Eigen::RowMajor>& A,
+                                   const bailey::DDVector& p, bailey::DDVector& w) {
+    eigen_assert(A.isCompressed() && w.size() == A.rows());
+
+    const int* outer = A.outerIndexPtr();
+    const int* inner = A.innerIndexPtr();
+    const double* values = A.valuePtr();
+    const double* ph = p.hi();
+    const double* pl = p.lo();
+    double* wh = w.hi();
+    double* wl = w.lo();
+
+    #pragma omp parallel for schedule(dynamic, 64)
+    for (Eigen::Index i = 0; i < A.rows(); ++i) {
+        dd_soa::row_product(outer, inner, values, ph, pl, i, wh[i], wl[i]);
+    }
+}
+
+template<>
+inline bailey::DDNumber spmv_dot<bailey::DDNumber>(const Eigen::SparseMatrix<double, Eigen::RowMajor>& A,
+                                                   const bailey::DDVector& p, bailey::DDVector& w) {
+    eigen_assert(A.isCompressed() && w.size() == A.rows());
+
+    const int* outer = A.outerIndexPtr();
+    const int* inner = A.innerIndexPtr();
+    const double* values = A.valuePtr();
+    const double* ph = p.hi();
+    const double* pl = p.lo();
+    double* wh = w.hi();
+    double* wl = w.lo();
+
+    return bailey_blas::reduce<bailey::DDNumber>(A.rows(),
+        [&](std::size_t begin, std::size_t end, Accumulator<bailey::DDNumber>& acc) {
+            dd_soa::lane_sum(begin, end, [&](std::size_t i, double& th, double& tl) {
+                dd_soa::row_product(outer, inner, values, ph, pl, i, wh[i], wl[i]);
+                bailey::dd_kernels::mul(ph[i], pl[i], wh[i], wl[i], th, tl);
+            }, acc);
+        });
+}
+
+template<>
+inline void spmv<bailey::DDNumber>(const bailey::SymmetricCsrMatrix<bailey::DDNumber>& A,
+                                   const bailey::DDVector& p, bailey::DDVector& w) {
+    dd_soa::symmetric_spmv(A, p, w);
+}
+
+template<>
+inline bailey::DDNumber spmv_dot<bailey::DDNumber>(const bailey::SymmetricCsrMatrix<bailey::DDNumber>& A,
+                                                   const bailey::DDVector& p, bailey::DDVector& w) {
+    return dd_soa::symmetric_spmv_dot(A, p, w);
+}
+
+template<>
+inline void spmv<bailey::DDNumber>(const bailey::SymmetricCsrMatrix<double>& A,
+                                   const bailey::DDVector& p, bailey::DDVector& w) {
+    dd_soa::symmetric_spmv(A, p, w);
+}
+
+template<>
+inline bailey::DDNumber spmv_dot<bailey::DDNumber>(const bailey::SymmetricCsrMatrix<double>& A,
+                                                   const bailey::DDVector& p, bailey::DDVector& w) {
+    return dd_soa::symmetric_spmv_dot(A, p, w);
+}
+
+template<>
+inline void axpy<bailey::DDNumber>(const bailey::DDNumber& alpha,
+                                   const bailey::DDVector& x, bailey::DDVector& y) {
+    namespace k = bailey::dd_kernels;
+    const double ah = alpha.dd[0];
+    const double al = alpha.dd[1];
+    const double* xh = x.hi();
+    const double* xl = x.lo();
+    double* yh = y.hi();
+    double* yl = y.lo();
+
+    const std::size_t n = static_cast<std::size_t>(y.size());
+
+    #pragma omp parallel for schedule(static)
+    for (std::size_t c = 0; c < bailey_blas::reduction_chunks; ++c) {
+        const std::size_t begin = bailey_blas::chunk_begin(n, c);
+        const std::size_t end = bailey_blas::chunk_begin(n, c + 1);
+        std::size_t i = begin + bailey::dd_simd::axpy(ah, al, xh + begin, xl + begin,
+                                                      yh + begin, yl + begin, end - begin);
+        for (; i < end; ++i) {
+            double th, tl;
+            k::mul(ah, al, xh[i], xl[i], th, tl);
+            k::add(yh[i], yl[i], th, tl, yh[i], yl[i]);
+        }
+    }
+}
+
+template<>
+inline void xpby<bailey::DDNumber>(const bailey::DDVector& r, const bailey::DDNumber& beta,
+                                   bailey::DDVector& p) {
+    namespace k = bailey::dd_kernels;
+    const double bh = beta.dd[0];
+    const double bl = beta.dd[1];
+    const double* rh = r.hi();
+    const double* rl = r.lo();
+    double* ph = p.hi();
+    double* pl = p.lo();
+
+    const std::size_t n = static_cast<std::size_t>(p.size());
+
+    #pragma omp parallel for schedule(static)
+    for (std::size_t c = 0; c < bailey_blas::reduction_chunks; ++c) {
+        const std::size_t begin = bailey_blas::chunk_begin(n, c);
+        const std::size_t end = bailey_blas::chunk_begin(n, c + 1);
+        std::size_t i = begin + bailey::dd_simd::xpby(rh + begin, rl + begin, bh, bl,
+                                                      ph + begin, pl + begin, end - begin);
+        for (; i < end; ++i) {
+            double th, tl;
+            k::mul(bh, bl, ph[i], pl[i], th, tl);
+            k::add(rh[i], rl[i], th, tl, ph[i], pl[i]);
+        }
+    }
+}
+
+template<>
+inline bailey::DDNumber axpy_dot<bailey::DDNumber>(const bailey::DDNumber& alpha,
+                                                   const bailey::DDVector& w, bailey::DDVector& r) {
+    namespace k = bailey::dd_kernels;
+    const double ah = alpha.dd[0];
+    const double al = alpha.dd[1];
+    const double* wh = w.hi();
+    const double* wl = w.lo();
+    double* rh = r.hi();
+    double* rl = r.lo();
+
+    return bailey_blas::reduce<bailey::DDNumber>(r.size(),
+        [&](std::size_t begin, std::size_t end, Accumulator<bailey::DDNumber>& acc) {
+            dd_soa::lane_sum(begin, end, [&](std::size_t i, double& th, double& tl) {
+                double uh, ul;
+                k::mul(ah, al, wh[i], wl[i], uh, ul);
+                k::sub(rh[i], rl[i], uh, ul, rh[i], rl[i]);
+                k::mul(rh[i], rl[i], rh[i], rl[i], th, tl);
+            }, acc);
+        });
+}
+
+template<>
+inline bailey::DDNumber diff_dot<bailey::DDNumber>(const bailey::DDVector& a, const bailey::DDVector& b,
+                                                   bailey::DDVector& d) {
+    namespace k = bailey::dd_kernels;
+    const double* ah = a.hi();
+    const double* al = a.lo();
+    const double* bh = b.hi();
+    const double* bl = b.lo();
+    double* dh = d.hi();
+    double* dl = d.lo();
+
+    return bailey_blas::reduce<bailey::DDNumber>(d.size(),
+        [&](std::size_t begin, std::size_t end, Accumulator<bailey::DDNumber>& acc) {
+            dd_soa::lane_sum(begin, end, [&](std::size_t i, double& th, double& tl) {
+                k::sub(ah[i], al[i], bh[i], bl[i], dh[i], dl[i]);
+                k::mul(dh[i], dl[i], dh[i], dl[i], th, tl);
+            }, acc);
+        });
+}
+
+} // namespace algorithms::kernels
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "bailey/precision_traits.hpp"
+#include "algorithms/cg_kernels.hpp"
 #include <iostream>
 #include <cmath>
 #include <vector>
@@ -9,9 +10,67 @@
 #include <chrono>
 #include <sstream>
 #include <variant>
+#include <algorithm>
+#include <stdexcept>
+#include <limits>
 
 namespace algorithms {
 
+/// Receiver of convergence history entries while a solve runs
+///
+/// When DiagnosticsPolicy::sink is set, solvers hand every history entry to
+/// the sink instead of appending it to the CGResult vectors, so the history
+/// needs no memory proportional to the iteration count
+/// (io::HistoryStream writes it to a file from a background thread).
+/// Calls come from the solver thread, once per recorded entry.
+class HistorySink {
+public:
+    virtual ~HistorySink() = default;
+
+    /// Relative residual 2-norm after iteration iter
+    virtual void residual(int iter, double relres_2) = 0;
+
+    /// Relative error 2-norm and A-norm after iteration iter
+    virtual void error(int iter, double relerr_2, double relerr_A) = 0;
+};
+
+/// Convergence diagnostics recorded by the solver
+enum class DiagnosticsMode {
+    None,       ///< Final metrics only (one SpMV per iteration)
+    Residual,   ///< Relative residual history every iteration
+    Full        ///< Residual history plus error norms every `interval` iterations
+};
+
+/// Diagnostics policy for conjugateGradient
+///
+/// Error norms need x_true and an extra SpMV (A*err) per recorded iteration,
+/// so production solves should use None or Residual.
+struct DiagnosticsPolicy {
+    DiagnosticsMode mode{DiagnosticsMode::Full};
+    int interval{1};    ///< Record error norms every `interval` iterations (Full only)
+    HistorySink* sink{nullptr};  ///< Stream histories here instead of storing them (not owned)
+
+    bool records_residual() const { return mode != DiagnosticsMode::None; }
+    bool records_error() const { return mode == DiagnosticsMode::Full; }
+    bool streams() const { return sink != nullptr; }
+};
+
+inline const char* to_string(DiagnosticsMode mode) {
+    switch (mode) {
+        case DiagnosticsMode::None:     return "none";
+        case DiagnosticsMode::Residual: return "residual";
+        case DiagnosticsMode::Full:     return "full";
+    }
+    return "unknown";
+}
+
+inline DiagnosticsMode parse_diagnostics_mode(const std::string& name) {
+    if (name == "none") return DiagnosticsMode::None;
+    if (name == "residual") return DiagnosticsMode::Residual;
+    if (name == "full") return DiagnosticsMode::Full;
+    throw std::runtime_error("Invalid diagnostics mode. Use: none, residual, or full");
+}
+
 /// Results structure for Conjugate Gradient solver
 /// Contains convergence history and performance metrics
 template<typename T>
@@ -22,112 +81,319 @@ struct CGResult {
     int iterations_performed;           ///< Number of iterations performed
     bool converged;                     ///< Whether convergence was achieved
     double computation_time;            ///< Wall-clock time in seconds
+    DiagnosticsPolicy diagnostics;      ///< Diagnostics policy used for this solve
     
-    // Convergence history
+    // Convergence history (empty when not recorded by the diagnostics policy or streamed to its sink)
     std::vector<double> hist_relres_2;  ///< Relative residual 2-norm history
     std::vector<double> hist_relerr_2;  ///< Relative error 2-norm history  
     std::vector<double> hist_relerr_A;  ///< Relative error A-norm history
+    std::vector<int> hist_relerr_iter;  ///< Iteration index of each error history entry
     
     // Final metrics
     double true_relres_2;               ///< True relative residual (b-Ax verification)
     double final_residual_norm;         ///< Final relative residual norm
     double initial_residual_norm;       ///< Initial residual norm
+    double final_relerr_2{std::numeric_limits<double>::quiet_NaN()};  ///< Last recorded relative error 2-norm
+    double final_relerr_A{std::numeric_limits<double>::quiet_NaN()};  ///< Last recorded relative error A-norm
     std::string precision_name{Traits::name()};  ///< Precision level name
+    
+    // Iterative refinement (iterative_refinement.hpp); zero for plain CG
+    int outer_iterations{0};            ///< Refinement steps (outer residual corrections)
+    int inner_iterations{0};            ///< Inner CG iterations summed over all steps
+    std::size_t history_entries{0};     ///< History entries recorded so far, stored or streamed
+
+    /// Reserve the history vectors (no-op when diagnostics stream to a sink)
+    /// @param residual_entries Residual entries to reserve (if residuals are recorded)
+    /// @param error_entries Error entries to reserve (if errors are recorded)
+    void reserve_history(int residual_entries, int error_entries) {
+        if (diagnostics.streams()) {
+            return;
+        }
+        if (diagnostics.records_residual()) {
+            hist_relres_2.reserve(residual_entries);
+        }
+        if (diagnostics.records_error()) {
+            hist_relerr_2.reserve(error_entries);
+            hist_relerr_A.reserve(error_entries);
+            hist_relerr_iter.reserve(error_entries);
+        }
+    }
+
+    /// Append a residual history entry, or pass it to diagnostics.sink
+    void record_residual(int iter, double relres_2) {
+        ++history_entries;
+        if (diagnostics.streams()) {
+            diagnostics.sink->residual(iter, relres_2);
+        } else {
+            hist_relres_2.push_back(relres_2);
+        }
+    }
+
+    /// Append an error history entry, or pass it to diagnostics.sink
+    void record_error(int iter, double relerr_2, double relerr_A) {
+        final_relerr_2 = relerr_2;
+        final_relerr_A = relerr_A;
+        ++history_entries;
+        if (diagnostics.streams()) {
+            diagnostics.sink->error(iter, relerr_2, relerr_A);
+        } else {
+            hist_relerr_2.push_back(relerr_2);
+            hist_relerr_A.push_back(relerr_A);
+            hist_relerr_iter.push_back(iter);
+        }
+    }
+};
+
+/// Preallocated work vectors for conjugateGradient
+///
+/// All vectors touched inside the iteration loop live here, so that once
+/// resize() has run, steady-state CG iterations perform no heap allocation.
+/// A workspace can be reused across solves of the same size.
+template<typename T>
+struct CGWorkspace {
+    using VectorType = typename bailey::PrecisionTraits<T>::vector_type;
+
+    VectorType r;      ///< Residual b - Ax
+    VectorType p;      ///< Search direction
+    VectorType w;      ///< A * p
+    VectorType err;    ///< Error x_true - x (analysis only)
+    VectorType Aerr;   ///< A * err (analysis only)
+    VectorType z;      ///< Preconditioned residual M^{-1} r (PCG only)
+
+    /// Allocate work vectors for a problem of size n (no-op if already sized)
+    /// @param error_vectors Also allocate err/Aerr (needed for error diagnostics)
+    /// @param preconditioned Also allocate z (preconditioned_cg.hpp)
+    void resize(Eigen::Index n, bool error_vectors = true, bool preconditioned = false) {
+        if (r.size() != n) {
+            r.resize(n);
+            p.resize(n);
+            w.resize(n);
+        }
+        if (error_vectors && err.size() != n) {
+            err.resize(n);
+            Aerr.resize(n);
+        }
+        if (preconditioned && z.size() != n) {
+            z.resize(n);
+        }
+    }
+};
+
+/// Iteration state of conjugateGradient after `iteration` iterations
+///
+/// Everything the CG loop carries from one iteration to the next, plus the
+/// result recorded so far. A solve resumed from it (CheckpointPolicy::resume)
+/// continues bit-identically to the uninterrupted solve.
+template<typename T>
+struct CGState {
+    using VectorType = typename bailey::PrecisionTraits<T>::vector_type;
+
+    int iteration{0};            ///< Completed iterations
+    VectorType x;                ///< Iterate
+    VectorType r;                ///< Recursive residual
+    VectorType p;                ///< Next search direction
+    T rho_old{};                 ///< (r,r)
+    double relres{0.0};          ///< ||r||/||b|| after `iteration`
+    double elapsed_time{0.0};    ///< Solve time up to this state in seconds
+    bool streamed{false};        ///< Histories went to a sink (progress holds none)
+    CGResult<T> progress;        ///< Initial norm, histories, final error norms and history_entries so far
+
+    /// True if a solve with these diagnostics continues this state's histories
+    /// consistently (same mode, error interval and storage of the histories)
+    /// @param streams Whether the resumed solve streams its histories to a sink
+    bool resumable_with(const DiagnosticsPolicy& diagnostics, bool streams) const {
+        const DiagnosticsPolicy& saved = progress.diagnostics;
+        return saved.mode == diagnostics.mode &&
+               (!diagnostics.records_error() || std::max(1, saved.interval) == std::max(1, diagnostics.interval)) &&
+               streamed == streams;
+    }
 };
 
-/// Conjugate Gradient solver with comprehensive convergence tracking
+/// Receiver of CG states for checkpointing
+///
+/// save() is called on the solver thread every CheckpointPolicy::interval
+/// iterations; it must copy what it keeps before returning
+/// (io::CheckpointWriter writes the copy from a background thread).
+template<typename T>
+class CheckpointSink {
+public:
+    virtual ~CheckpointSink() = default;
+
+    /// Take a snapshot of the solver state (references are only valid during the call)
+    virtual void save(int iteration,
+                      const typename bailey::PrecisionTraits<T>::vector_type& x,
+                      const typename bailey::PrecisionTraits<T>::vector_type& r,
+                      const typename bailey::PrecisionTraits<T>::vector_type& p,
+                      const T& rho_old, double relres, double elapsed_time,
+                      const CGResult<T>& progress) = 0;
+};
+
+/// Checkpoint/restart policy for conjugateGradient
+template<typename T>
+struct CheckpointPolicy {
+    CheckpointSink<T>* sink{nullptr};   ///< Receives a state every `interval` iterations (not owned)
+    int interval{0};                    ///< Iterations between checkpoints (0: none)
+    const CGState<T>* resume{nullptr};  ///< Continue from this state instead of starting at x
+
+    bool saves() const { return sink != nullptr && interval > 0; }
+};
+
+/// Conjugate Gradient solver with configurable convergence tracking
 /// 
 /// Solves the linear system Ax = b using the Conjugate Gradient method.
 /// Supports multiple precision levels through template specialization.
+/// Work vectors are taken from @p ws and updated in place, so the iteration
+/// loop is allocation-free. All vector work goes through cg_kernels.hpp:
+/// SpMV and residual updates are fused with the dot products they feed, and
+/// run thread-parallel (OpenMP) with thread-count independent reductions.
 /// 
-/// @param A Symmetric positive definite matrix
+/// @param A Symmetric positive definite matrix: PrecisionTraits<T>::matrix_type
+///          or bailey::SymmetricCsrMatrix (anything with kernels::spmv/spmv_dot)
 /// @param b Right-hand side vector  
 /// @param x Initial guess (modified in-place)
-/// @param x_true True solution for error analysis
+/// @param x_true True solution for error analysis (unused unless diagnostics are Full)
 /// @param max_iter Maximum number of iterations
 /// @param tolerance Convergence tolerance for relative residual
+/// @param ws Work vectors (resized to A.rows() if needed)
+/// @param diagnostics Which convergence histories to record
+/// @param checkpoint Periodic state snapshots, and an optional state to resume from
+///                   (x is then overwritten by the resumed iterate)
 /// @return CGResult containing convergence history and statistics
-template<typename T>
+/// @throws std::runtime_error if the resumed state does not match A or @p diagnostics
+template<typename T, typename MatrixType = typename bailey::PrecisionTraits<T>::matrix_type>
 CGResult<T> conjugateGradient(
-    const typename bailey::PrecisionTraits<T>::matrix_type& A, 
+    const MatrixType& A, 
     const typename bailey::PrecisionTraits<T>::vector_type& b, 
     typename bailey::PrecisionTraits<T>::vector_type& x, 
     const typename bailey::PrecisionTraits<T>::vector_type& x_true,
     int max_iter, 
-    double tolerance
+    double tolerance,
+    CGWorkspace<T>& ws,
+    const DiagnosticsPolicy& diagnostics = {},
+    const CheckpointPolicy<T>& checkpoint = {}
 ) {
-    using Traits = bailey::PrecisionTraits<T>;
-    using VectorType = typename Traits::vector_type;
-    
     auto start_time = std::chrono::high_resolution_clock::now();
     
-    // Precompute norms for relative error calculations
-    T norm2_b = sqrt(b.dot(b));
-    T norm2_x_true = sqrt(x_true.dot(x_true));
-    T normA_x_true = sqrt(x_true.dot(A * x_true));
+    const bool track_residual = diagnostics.records_residual();
+    const bool track_error = diagnostics.records_error();
+    const int error_interval = std::max(1, diagnostics.interval);
+    
+    ws.resize(A.rows(), track_error);
+    auto& r = ws.r;
+    auto& p = ws.p;
+    auto& w = ws.w;
+    auto& err = ws.err;
+    auto& Aerr = ws.Aerr;
     
     CGResult<T> result;
-    result.hist_relres_2.reserve(max_iter + 1);
-    result.hist_relerr_2.reserve(max_iter + 1);
-    result.hist_relerr_A.reserve(max_iter + 1);
+    result.diagnostics = diagnostics;
+    result.reserve_history(max_iter + 1, max_iter / error_interval + 2);
     
-    // Initialize residual: r = b - Ax
-    VectorType r = b - A * x;
+    // Precompute norms for relative residual/error calculations
+    T norm2_b = sqrt(kernels::dot<T>(b, b));
+    T norm2_x_true = T(0.0);
+    T normA_x_true = T(0.0);
+    if (track_error) {
+        norm2_x_true = sqrt(kernels::dot<T>(x_true, x_true));
+        normA_x_true = sqrt(kernels::spmv_dot<T>(A, x_true, Aerr));
+    }
     
-    // Calculate initial error vector
-    VectorType err = x_true - x;
+    // Record error metrics for iteration `iter` (err = x_true - x, one extra SpMV)
+    auto record_error = [&](int iter) {
+        T err_dot = kernels::diff_dot<T>(x_true, x, err);
+        T err_A_dot = kernels::spmv_dot<T>(A, err, Aerr);
+        result.record_error(iter, to_double(sqrt(err_dot) / norm2_x_true),
+                            to_double(sqrt(err_A_dot) / normA_x_true));
+    };
     
-    // Store initial convergence metrics
-    T initial_residual_norm = sqrt(r.dot(r));
-    result.initial_residual_norm = to_double(initial_residual_norm);
-    result.hist_relres_2.push_back(to_double(initial_residual_norm / norm2_b));
-    result.hist_relerr_2.push_back(to_double(sqrt(err.dot(err)) / norm2_x_true));
-    result.hist_relerr_A.push_back(to_double(sqrt(err.dot(A * err)) / normA_x_true));
+    T rho_old;
+    double relres;
+    double elapsed_before = 0.0;  // Solve time of the run a resumed state comes from
+    int first_iter = 1;
     
-    // Initialize search direction p = r
-    VectorType p = r;
+    if (const CGState<T>* state = checkpoint.resume) {
+        // Continue from a checkpoint: the loop variables are exactly those of iteration state->iteration
+        if (state->x.size() != A.rows() || state->r.size() != A.rows() || state->p.size() != A.rows()) {
+            throw std::runtime_error("Checkpoint does not match the problem size");
+        }
+        // cg_solver checks this before touching any output; other callers get the error here
+        if (!state->resumable_with(diagnostics, diagnostics.streams())) {
+            throw std::runtime_error("Checkpoint was written with different diagnostics settings");
+        }
+        x = state->x;
+        r = state->r;
+        p = state->p;
+        rho_old = state->rho_old;
+        relres = state->relres;
+        elapsed_before = state->elapsed_time;
+        first_iter = state->iteration + 1;
+        result.initial_residual_norm = state->progress.initial_residual_norm;
+        result.hist_relres_2 = state->progress.hist_relres_2;
+        result.hist_relerr_2 = state->progress.hist_relerr_2;
+        result.hist_relerr_A = state->progress.hist_relerr_A;
+        result.hist_relerr_iter = state->progress.hist_relerr_iter;
+        result.final_relerr_2 = state->progress.final_relerr_2;
+        result.final_relerr_A = state->progress.final_relerr_A;
+        result.history_entries = state->progress.history_entries;
+    } else {
+        // Initialize residual r = b - Ax and rho = (r,r) for beta calculation
+        kernels::spmv<T>(A, x, w);
+        rho_old = kernels::diff_dot<T>(b, w, r);
+        
+        // Store initial convergence metrics
+        T initial_residual_norm = sqrt(rho_old);
+        relres = to_double(initial_residual_norm / norm2_b);
+        result.initial_residual_norm = to_double(initial_residual_norm);
+        if (track_residual) {
+            result.record_residual(0, relres);
+        }
+        if (track_error) {
+            record_error(0);
+        }
+        
+        // Initialize search direction p = r
+        p = r;
+    }
     
-    // Initialize rho for beta calculation
-    T rho_old = r.dot(r);
+    auto elapsed = [&] {
+        auto now = std::chrono::high_resolution_clock::now();
+        return elapsed_before + std::chrono::duration<double>(now - start_time).count();
+    };
     
     // Main CG iteration loop
     bool is_converged = false;
-    int iter_final = 0;
+    int iter_final = first_iter - 1;
     
-    for (int iter = 1; iter <= max_iter; ++iter) {
-        // Compute matrix-vector product
-        VectorType w = A * p;
-        
-        // Compute denominator for step size
-        T sigma = p.dot(w);
+    for (int iter = first_iter; iter <= max_iter; ++iter) {
+        // Compute w = A*p and the step-size denominator (p,Ap) in one sweep
+        T sigma = kernels::spmv_dot<T>(A, p, w);
         
         // Compute step size α = (r,r) / (p,Ap)
         T alpha = rho_old / sigma;
         
         // Update solution: x = x + α*p
-        x = x + alpha * p;
+        kernels::axpy<T>(alpha, p, x);
         
-        // Update residual: r = r - α*Ap
-        r = r - alpha * w;
+        // Update residual r = r - α*Ap together with (r_{k+1},r_{k+1})
+        T rho_new = kernels::axpy_dot<T>(alpha, w, r);
         
-        // Compute current error for analysis
-        err = x_true - x;
+        // Check convergence: ||r||₂ / ||b||₂ < tolerance
+        relres = to_double(sqrt(rho_new) / norm2_b);
+        is_converged = relres < tolerance;
+        iter_final = iter;
         
         // Record convergence metrics
-        result.hist_relres_2.push_back(to_double(sqrt(r.dot(r)) / norm2_b));
-        result.hist_relerr_2.push_back(to_double(sqrt(err.dot(err)) / norm2_x_true));
-        result.hist_relerr_A.push_back(to_double(sqrt(err.dot(A * err)) / normA_x_true));
+        if (track_residual) {
+            result.record_residual(iter, relres);
+        }
+        if (track_error && (iter % error_interval == 0 || is_converged || iter == max_iter)) {
+            record_error(iter);
+        }
         
-        // Check convergence: ||r||₂ / ||b||₂ < tolerance
-        if (result.hist_relres_2.back() < tolerance) {
-            is_converged = true;
-            iter_final = iter;
+        if (is_converged) {
             break;
         }
         
-        // Compute new inner product for next β
-        T rho_new = r.dot(r);
-        
         // Compute β = (r_{k+1},r_{k+1}) / (r_k,r_k)
         T beta = rho_new / rho_old;
         
@@ -135,61 +401,89 @@ CGResult<T> conjugateGradient(
         rho_old = rho_new;
         
         // Update search direction: p = r + β*p
-        p = r + beta * p;
+        kernels::xpby<T>(r, beta, p);
         
-        iter_final = iter;
+        // Snapshot the state entering iteration iter + 1
+        if (checkpoint.saves() && iter % checkpoint.interval == 0) {
+            checkpoint.sink->save(iter, x, r, p, rho_old, relres, elapsed(), result);
+        }
     }
     
     // Finalize results
     result.iterations_performed = iter_final;
     result.converged = is_converged;
-    result.final_residual_norm = result.hist_relres_2.back();
+    result.final_residual_norm = relres;
     
     auto end_time = std::chrono::high_resolution_clock::now();
     auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(end_time - start_time);
-    result.computation_time = duration.count() / 1000.0;
+    result.computation_time = elapsed_before + duration.count() / 1000.0;
     
     // Compute true residual to check for gap with computed residual
-    VectorType true_residual = b - A * x;
-    T true_residual_norm = sqrt(true_residual.dot(true_residual));
+    kernels::spmv<T>(A, x, w);
+    T true_residual_norm = sqrt(kernels::diff_dot<T>(b, w, w));
     result.true_relres_2 = to_double(true_residual_norm / norm2_b);
     
     return result;
 }
 
+/// Conjugate Gradient solver using a workspace local to this call
+/// 
+/// @see conjugateGradient(A, b, x, x_true, max_iter, tolerance, ws, diagnostics, checkpoint)
+template<typename T, typename MatrixType = typename bailey::PrecisionTraits<T>::matrix_type>
+CGResult<T> conjugateGradient(
+    const MatrixType& A, 
+    const typename bailey::PrecisionTraits<T>::vector_type& b, 
+    typename bailey::PrecisionTraits<T>::vector_type& x, 
+    const typename bailey::PrecisionTraits<T>::vector_type& x_true,
+    int max_iter, 
+    double tolerance,
+    const DiagnosticsPolicy& diagnostics = {},
+    const CheckpointPolicy<T>& checkpoint = {}
+) {
+    CGWorkspace<T> ws;
+    return conjugateGradient<T, MatrixType>(A, b, x, x_true, max_iter, tolerance, ws, diagnostics, checkpoint);
+}
+
 /// Print formatted results from CG solver
 /// 
 /// @param result CG solver results
 /// @param problem_name Optional problem identifier for display
+/// @param out Output stream (per-job buffer in batch mode)
 template<typename T>
-void print_results(const CGResult<T>& result, const std::string& problem_name = "") {
-    std::cout << "========================== " << std::endl;
-    std::cout << "Numerical Results. " << std::endl;
+void print_results(const CGResult<T>& result, const std::string& problem_name = "",
+                   std::ostream& out = std::cout) {
+    out << "========================== " << std::endl;
+    out << "Numerical Results. " << std::endl;
     if (!problem_name.empty()) {
-        std::cout << "Problem: " << problem_name << " " << std::endl;
+        out << "Problem: " << problem_name << " " << std::endl;
     }
-    std::cout << "Precision: " << result.precision_name << " (" 
-              << bailey::PrecisionTraits<T>::decimal_digits() << " digits)" << std::endl;
-    std::cout << "========================== " << std::endl;
+    out << "Precision: " << result.precision_name << " (" 
+        << bailey::PrecisionTraits<T>::decimal_digits() << " digits)" << std::endl;
+    out << "========================== " << std::endl;
 
     if (result.converged) {
-        std::cout << "Converged! (iter = " << result.iterations_performed << ")" << std::endl;
+        out << "Converged! (iter = " << result.iterations_performed << ")" << std::endl;
     } else {
-        std::cout << "NOT converged. (max_iter = " << result.iterations_performed << ")" << std::endl;
+        out << "NOT converged. (max_iter = " << result.iterations_performed << ")" << std::endl;
     }
 
-    std::cout << "# Iter.: " << result.iterations_performed << std::endl;
-    std::cout << std::fixed << std::setprecision(3) << "Time[s]: " << result.computation_time << std::endl;
-    std::cout << std::scientific << std::setprecision(2);
+    out << "# Iter.: " << result.iterations_performed << std::endl;
+    if (result.outer_iterations > 0) {
+        out << "# Outer iter.: " << result.outer_iterations
+            << ", # Inner iter.: " << result.inner_iterations << std::endl;
+    }
+    out << std::fixed << std::setprecision(3) << "Time[s]: " << result.computation_time << std::endl;
+    out << std::scientific << std::setprecision(2);
     
     // Display final convergence metrics
-    int final_idx = result.iterations_performed;
-    std::cout << "Relres_2norm = " << result.hist_relres_2[final_idx] << std::endl;
-    std::cout << "True_Relres_2norm = " << result.true_relres_2 << std::endl;
-    std::cout << "Relerr_2norm = " << result.hist_relerr_2[final_idx] << std::endl;
-    std::cout << "Relerr_Anorm = " << result.hist_relerr_A[final_idx] << std::endl;
-    std::cout << "========================== " << std::endl;
-    std::cout << std::endl;
+    out << "Relres_2norm = " << result.final_residual_norm << std::endl;
+    out << "True_Relres_2norm = " << result.true_relres_2 << std::endl;
+    if (!std::isnan(result.final_relerr_2)) {
+        out << "Relerr_2norm = " << result.final_relerr_2 << std::endl;
+        out << "Relerr_Anorm = " << result.final_relerr_A << std::endl;
+    }
+    out << "========================== " << std::endl;
+    out << std::endl;
 }
 
 /// Resolve maximum iteration count from user specification
@@ -0,0 +1,211 @@
+#pragma once
+
+#include "algorithms/conjugate_gradient.hpp"
+#include <type_traits>
+
+namespace algorithms {
+
+/// Parameters of the mixed-precision iterative refinement driver
+struct RefinementParameters {
+    int max_outer{50};              ///< Maximum refinement (outer) steps
+    double inner_tolerance{1.0e-8}; ///< Relative residual target of each inner CG solve
+};
+
+namespace detail {
+
+/// Round an outer-precision value to the inner precision (double or DD)
+template<typename Inner, typename Outer>
+Inner narrow(const Outer& v) {
+    if constexpr (std::is_same_v<Inner, Outer>) {
+        return v;
+    } else if constexpr (std::is_same_v<Inner, double>) {
+        return to_double(v);
+    } else {
+        static_assert(std::is_same_v<Inner, bailey::DDNumber>, "inner precision must be double or DD");
+        double hi = to_double(v);
+        double lo = to_double(v - Outer(hi));
+        return bailey::DDNumber(hi) + bailey::DDNumber(lo);
+    }
+}
+
+/// Widen an inner-precision value (double or DD) to the outer precision
+template<typename Outer, typename Inner>
+Outer widen(const Inner& v) {
+    if constexpr (std::is_same_v<Inner, Outer>) {
+        return v;
+    } else if constexpr (std::is_same_v<Inner, double>) {
+        return Outer(v);
+    } else {
+        static_assert(std::is_same_v<Inner, bailey::DDNumber>, "inner precision must be double or DD");
+        return Outer(v.dd[0]) + Outer(v.dd[1]);
+    }
+}
+
+/// Copy a sparse matrix into another precision, keeping its CSR structure
+///
+/// From is the stored value type: the outer precision, or double when the
+/// outer matrix uses mixed storage.
+template<typename To, typename From>
+typename bailey::PrecisionTraits<To>::matrix_type
+convert_matrix(const Eigen::SparseMatrix<From, Eigen::RowMajor>& A) {
+    typename bailey::PrecisionTraits<To>::matrix_type B =
+        A.unaryExpr([](const From& v) { return narrow<To>(v); });
+    B.makeCompressed();
+    return B;
+}
+
+/// Copy a symmetric-storage matrix into another precision
+template<typename To, typename From>
+bailey::SymmetricCsrMatrix<To> convert_matrix(const bailey::SymmetricCsrMatrix<From>& A) {
+    return A.template cast<To>([](const From& v) { return narrow<To>(v); });
+}
+
+} // namespace detail
+
+/// Mixed-precision iterative refinement with a CG inner solver
+///
+/// Each refinement step computes the residual r = b - Ax in the outer
+/// precision, solves A d = r / ||r|| with conjugateGradient<Inner> on a copy
+/// of A rounded to the inner precision (double by default), and applies the
+/// correction x += ||r|| d in the outer precision. The bulk of the work (the
+/// inner CG iterations) runs in fast arithmetic, while the attainable accuracy
+/// is set by the outer residual.
+///
+/// Histories are recorded per refinement step: hist_relres_2[k] is the true
+/// relative residual after k corrections. iterations_performed and
+/// outer_iterations count refinement steps; inner_iterations sums the inner
+/// CG iterations.
+///
+/// @param A Symmetric positive definite matrix (outer precision or double values, full or symmetric storage)
+/// @param b Right-hand side vector
+/// @param x Initial guess (modified in-place)
+/// @param x_true True solution for error analysis (unused unless diagnostics are Full)
+/// @param max_inner_iter Maximum iterations of each inner CG solve
+/// @param tolerance Convergence tolerance for the outer relative residual
+/// @param params Outer step limit and inner tolerance
+/// @param diagnostics Which convergence histories to record (per outer step)
+/// @return CGResult in the outer precision
+template<typename Outer, typename Inner = double,
+         typename MatrixType = typename bailey::PrecisionTraits<Outer>::matrix_type>
+CGResult<Outer> iterativeRefinement(
+    const MatrixType& A,
+    const typename bailey::PrecisionTraits<Outer>::vector_type& b,
+    typename bailey::PrecisionTraits<Outer>::vector_type& x,
+    const typename bailey::PrecisionTraits<Outer>::vector_type& x_true,
+    int max_inner_iter,
+    double tolerance,
+    const RefinementParameters& params = {},
+    const DiagnosticsPolicy& diagnostics = {}
+) {
+    using OuterVector = typename bailey::PrecisionTraits<Outer>::vector_type;
+    using InnerVector = typename bailey::PrecisionTraits<Inner>::vector_type;
+
+    auto start_time = std::chrono::high_resolution_clock::now();
+
+    const bool track_residual = diagnostics.records_residual();
+    const bool track_error = diagnostics.records_error();
+    const Eigen::Index n = A.rows();
+
+    auto A_inner = detail::convert_matrix<Inner>(A);
+
+    OuterVector r(n), w(n), correction(n);
+    OuterVector err, Aerr;
+    InnerVector r_inner(n), d(n);
+    CGWorkspace<Inner> inner_ws;
+    inner_ws.resize(n, false);
+
+    CGResult<Outer> result;
+    result.diagnostics = diagnostics;
+    result.inner_iterations = 0;
+
+    Outer norm2_b = sqrt(kernels::dot<Outer>(b, b));
+    Outer norm2_x_true = Outer(0.0);
+    Outer normA_x_true = Outer(0.0);
+    if (track_error) {
+        err.resize(n);
+        Aerr.resize(n);
+        norm2_x_true = sqrt(kernels::dot<Outer>(x_true, x_true));
+        normA_x_true = sqrt(kernels::spmv_dot<Outer>(A, x_true, Aerr));
+    }
+
+    // A zero right-hand side has the exact solution x = 0; measure residual and
+    // errors in absolute terms instead of dividing by a zero norm
+    auto nonzero = [](const Outer& norm) { return to_double(norm) == 0.0 ? Outer(1.0) : norm; };
+    norm2_b = nonzero(norm2_b);
+    norm2_x_true = nonzero(norm2_x_true);
+    normA_x_true = nonzero(normA_x_true);
+
+    auto record_error = [&](int step) {
+        Outer err_dot = kernels::diff_dot<Outer>(x_true, x, err);
+        Outer err_A_dot = kernels::spmv_dot<Outer>(A, err, Aerr);
+        result.record_error(step, to_double(sqrt(err_dot) / norm2_x_true),
+                            to_double(sqrt(err_A_dot) / normA_x_true));
+    };
+
+    // Inner solves only need the final iterate
+    DiagnosticsPolicy inner_diagnostics;
+    inner_diagnostics.mode = DiagnosticsMode::None;
+
+    bool is_converged = false;
+    int step = 0;
+    double relres = 0.0;
+    double previous_relres = 0.0;
+
+    for (;; ++step) {
+        // Outer residual r = b - Ax
+        kernels::spmv<Outer>(A, x, w);
+        Outer residual_norm = sqrt(kernels::diff_dot<Outer>(b, w, r));
+        relres = to_double(residual_norm / norm2_b);
+        if (step == 0) {
+            result.initial_residual_norm = to_double(residual_norm);
+        }
+
+        if (track_residual) {
+            result.record_residual(step, relres);
+        }
+        if (track_error) {
+            record_error(step);
+        }
+
+        // An exact residual leaves nothing to refine (and r / ||r|| is undefined)
+        const double scale = to_double(residual_norm);
+        is_converged = relres < tolerance || scale == 0.0;
+        if (is_converged || step == params.max_outer) {
+            break;
+        }
+        // Stagnation: the inner precision can no longer improve the residual
+        if (step > 0 && relres >= previous_relres) {
+            break;
+        }
+        previous_relres = relres;
+
+        // Solve A d = r / ||r|| in the inner precision (scaled to avoid underflow)
+        for (Eigen::Index i = 0; i < n; ++i) {
+            r_inner[i] = detail::narrow<Inner>(Outer(r[i]) / Outer(scale));
+        }
+        d.setZero();
+        auto inner = conjugateGradient<Inner>(A_inner, r_inner, d, d, max_inner_iter,
+                                              params.inner_tolerance, inner_ws, inner_diagnostics);
+        result.inner_iterations += inner.iterations_performed;
+
+        // Correction x = x + ||r|| d in the outer precision
+        for (Eigen::Index i = 0; i < n; ++i) {
+            correction[i] = detail::widen<Outer>(Inner(d[i]));
+        }
+        kernels::axpy<Outer>(Outer(scale), correction, x);
+    }
+
+    result.outer_iterations = step;
+    result.iterations_performed = step;
+    result.converged = is_converged;
+    result.final_residual_norm = relres;
+    result.true_relres_2 = relres;  // the outer residual is computed from b - Ax
+
+    auto end_time = std::chrono::high_resolution_clock::now();
+    auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(end_time - start_time);
+    result.computation_time = duration.count() / 1000.0;
+
+    return result;
+}
+
+} // namespace algorithms
@@ -0,0 +1,246 @@
+#pragma once
+
+#include "algorithms/conjugate_gradient.hpp"
+#include "algorithms/cg_block_kernels.hpp"
+#include <vector>
+#include <stdexcept>
+
+namespace algorithms {
+
+/// Preallocated work blocks for multiRhsConjugateGradient
+template<typename T>
+struct MultiRhsCGWorkspace {
+    using BlockType = typename bailey::PrecisionTraits<T>::block_type;
+
+    BlockType R;       ///< Residuals B - AX
+    BlockType P;       ///< Search directions
+    BlockType W;       ///< A * P
+    BlockType Err;     ///< Errors X_true - X (analysis only)
+    BlockType AErr;    ///< A * Err (analysis only)
+
+    std::vector<T> alpha;
+    std::vector<T> beta;
+    std::vector<T> rr;       ///< (r_j, r_j) of the current iteration
+    std::vector<T> rr_new;
+    std::vector<T> pw;       ///< (p_j, A p_j)
+    std::vector<T> err_dot;
+    std::vector<T> err_A_dot;
+    bailey_blas::ReduceScratch<T> scratch;
+
+    /// Allocate work blocks for n unknowns and k right-hand sides (no-op if already sized)
+    /// @param error_vectors Also allocate Err/AErr (needed for error diagnostics)
+    void resize(Eigen::Index n, Eigen::Index k, bool error_vectors = true) {
+        if (R.rows() != n || R.cols() != k) {
+            R.resize(n, k);
+            P.resize(n, k);
+            W.resize(n, k);
+        }
+        if (error_vectors && (Err.rows() != n || Err.cols() != k)) {
+            Err.resize(n, k);
+            AErr.resize(n, k);
+        }
+        alpha.resize(k);
+        beta.resize(k);
+        rr.resize(k);
+        rr_new.resize(k);
+        pw.resize(k);
+        err_dot.resize(k);
+        err_A_dot.resize(k);
+    }
+};
+
+/// Conjugate Gradient for k right-hand sides of the same matrix
+///
+/// Runs k independent CG recurrences (one step size per column) in
+/// lockstep on n x k blocks, so each iteration is one SpMM
+/// (kernels::spmm_dot), which streams the matrix once for all k columns,
+/// plus one fused column-wise update. A column that has converged gets
+/// alpha = 0 and stays frozen while the others continue; the loop ends when
+/// every column has converged or max_iter is reached.
+///
+/// Column j follows exactly the operations of conjugateGradient on
+/// (B(:,j), X(:,j)), so its history matches a single-RHS solve.
+///
+/// @param A Symmetric positive definite matrix (full CSR or symmetric storage)
+/// @param B Right-hand sides, n x k (k <= kernels::max_block_columns)
+/// @param X Initial guesses, n x k (modified in-place)
+/// @param X_true True solutions for error analysis (unused unless diagnostics are Full)
+/// @param max_iter Maximum number of iterations
+/// @param tolerance Convergence tolerance for the relative residual of each column
+/// @param ws Work blocks (resized to n x k if needed)
+/// @param diagnostics Which convergence histories to record (per column)
+/// @return One CGResult per right-hand side; computation_time is the time of the whole block solve
+template<typename T, typename MatrixType = typename bailey::PrecisionTraits<T>::matrix_type>
+std::vector<CGResult<T>> multiRhsConjugateGradient(
+    const MatrixType& A,
+    const typename bailey::PrecisionTraits<T>::block_type& B,
+    typename bailey::PrecisionTraits<T>::block_type& X,
+    const typename bailey::PrecisionTraits<T>::block_type& X_true,
+    int max_iter,
+    double tolerance,
+    MultiRhsCGWorkspace<T>& ws,
+    const DiagnosticsPolicy& diagnostics = {}
+) {
+    const Eigen::Index k = B.cols();
+    if (k < 1 || k > kernels::max_block_columns) {
+        throw std::runtime_error("Multi-RHS CG requires 1 to " +
+                                 std::to_string(kernels::max_block_columns) + " right-hand sides");
+    }
+    if (diagnostics.streams()) {
+        throw std::runtime_error("Multi-RHS CG cannot stream histories (one sink would mix all columns)");
+    }
+
+    auto start_time = std::chrono::high_resolution_clock::now();
+
+    const bool track_residual = diagnostics.records_residual();
+    const bool track_error = diagnostics.records_error();
+    const int error_interval = std::max(1, diagnostics.interval);
+
+    ws.resize(A.rows(), k, track_error);
+    auto& R = ws.R;
+    auto& P = ws.P;
+    auto& W = ws.W;
+    auto& Err = ws.Err;
+    auto& AErr = ws.AErr;
+    auto& scratch = ws.scratch;
+
+    std::vector<CGResult<T>> results(k);
+    for (auto& result : results) {
+        result.diagnostics = diagnostics;
+        result.reserve_history(max_iter + 1, max_iter / error_interval + 2);
+    }
+
+    std::vector<T> norm2_b(k);
+    std::vector<T> norm2_x_true(k, T(0.0));
+    std::vector<T> normA_x_true(k, T(0.0));
+    kernels::block_dot<T>(B, B, scratch, norm2_b.data());
+    for (Eigen::Index j = 0; j < k; ++j) {
+        norm2_b[j] = sqrt(norm2_b[j]);
+    }
+    if (track_error) {
+        kernels::block_dot<T>(X_true, X_true, scratch, norm2_x_true.data());
+        kernels::spmm_dot<T>(A, X_true, AErr, scratch, normA_x_true.data());
+        for (Eigen::Index j = 0; j < k; ++j) {
+            norm2_x_true[j] = sqrt(norm2_x_true[j]);
+            normA_x_true[j] = sqrt(normA_x_true[j]);
+        }
+    }
+
+    // active[j]: column j still iterating (error entries are recorded for active columns)
+    std::vector<char> active(k, 1);
+    auto record_error = [&](int iter, const std::vector<char>& columns) {
+        kernels::block_diff_dot<T>(X_true, X, Err, scratch, ws.err_dot.data());
+        kernels::spmm_dot<T>(A, Err, AErr, scratch, ws.err_A_dot.data());
+        for (Eigen::Index j = 0; j < k; ++j) {
+            if (!columns[j]) {
+                continue;
+            }
+            results[j].record_error(iter, to_double(sqrt(ws.err_dot[j]) / norm2_x_true[j]),
+                                    to_double(sqrt(ws.err_A_dot[j]) / normA_x_true[j]));
+        }
+    };
+
+    // R = B - AX, P = R
+    kernels::spmm<T>(A, X, W);
+    kernels::block_diff_dot<T>(B, W, R, scratch, ws.rr.data());
+    P = R;
+
+    std::vector<double> relres(k);
+    for (Eigen::Index j = 0; j < k; ++j) {
+        T initial_residual_norm = sqrt(ws.rr[j]);
+        relres[j] = to_double(initial_residual_norm / norm2_b[j]);
+        results[j].initial_residual_norm = to_double(initial_residual_norm);
+        results[j].iterations_performed = 0;
+        results[j].converged = false;
+        if (track_residual) {
+            results[j].record_residual(0, relres[j]);
+        }
+    }
+    if (track_error) {
+        record_error(0, active);
+    }
+
+    Eigen::Index active_count = k;
+    std::vector<char> recording(k, 0);
+
+    for (int iter = 1; iter <= max_iter && active_count > 0; ++iter) {
+        // α_j = (r_j,r_j) / (p_j,Ap_j), 0 for converged columns
+        kernels::spmm_dot<T>(A, P, W, scratch, ws.pw.data());
+        for (Eigen::Index j = 0; j < k; ++j) {
+            ws.alpha[j] = active[j] ? ws.rr[j] / ws.pw[j] : T(0.0);
+        }
+
+        kernels::block_cg_update<T>(ws.alpha.data(), P, W, X, R, scratch, ws.rr_new.data());
+
+        bool any_converged = false;
+        for (Eigen::Index j = 0; j < k; ++j) {
+            recording[j] = active[j];
+            if (!active[j]) {
+                continue;
+            }
+            relres[j] = to_double(sqrt(ws.rr_new[j]) / norm2_b[j]);
+            results[j].iterations_performed = iter;
+            if (track_residual) {
+                results[j].record_residual(iter, relres[j]);
+            }
+            if (relres[j] < tolerance) {
+                results[j].converged = true;
+                active[j] = 0;
+                --active_count;
+                any_converged = true;
+            }
+        }
+        if (track_error && (iter % error_interval == 0 || any_converged || iter == max_iter)) {
+            // Off-interval entries only for the columns that just converged
+            if (iter % error_interval != 0 && iter != max_iter) {
+                for (Eigen::Index j = 0; j < k; ++j) {
+                    recording[j] = recording[j] && !active[j];
+                }
+            }
+            record_error(iter, recording);
+        }
+
+        // β_j = (r_{k+1},r_{k+1}) / (r_k,r_k), p = r + β*p
+        for (Eigen::Index j = 0; j < k; ++j) {
+            ws.beta[j] = active[j] ? ws.rr_new[j] / ws.rr[j] : T(0.0);
+            if (active[j]) {
+                ws.rr[j] = ws.rr_new[j];
+            }
+        }
+        if (active_count > 0) {
+            kernels::block_xpby<T>(R, ws.beta.data(), P);
+        }
+    }
+
+    auto end_time = std::chrono::high_resolution_clock::now();
+    auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(end_time - start_time);
+
+    kernels::spmm<T>(A, X, W);
+    kernels::block_diff_dot<T>(B, W, W, scratch, ws.rr_new.data());
+    for (Eigen::Index j = 0; j < k; ++j) {
+        results[j].final_residual_norm = relres[j];
+        results[j].computation_time = duration.count() / 1000.0;
+        results[j].true_relres_2 = to_double(sqrt(ws.rr_new[j]) / norm2_b[j]);
+    }
+
+    return results;
+}
+
+/// Multi-RHS CG using a workspace local to this call
+///
+/// @see multiRhsConjugateGradient(A, B, X, X_true, max_iter, tolerance, ws, diagnostics)
+template<typename T, typename MatrixType = typename bailey::PrecisionTraits<T>::matrix_type>
+std::vector<CGResult<T>> multiRhsConjugateGradient(
+    const MatrixType& A,
+    const typename bailey::PrecisionTraits<T>::block_type& B,
+    typename bailey::PrecisionTraits<T>::block_type& X,
+    const typename bailey::PrecisionTraits<T>::block_type& X_true,
+    int max_iter,
+    double tolerance,
+    const DiagnosticsPolicy& diagnostics = {}
+) {
+    MultiRhsCGWorkspace<T> ws;
+    return multiRhsConjugateGradient<T, MatrixType>(A, B, X, X_true, max_iter, tolerance, ws, diagnostics);
+}
+
+} // namespace algorithms
@@ -0,0 +1,199 @@
+#pragma once
+
+#include "algorithms/conjugate_gradient.hpp"
+
+namespace algorithms {
+
+/// Preallocated work vectors for pipelinedConjugateGradient
+template<typename T>
+struct PipelinedCGWorkspace {
+    using VectorType = typename bailey::PrecisionTraits<T>::vector_type;
+
+    VectorType r;      ///< Residual b - Ax (recursively updated)
+    VectorType w;      ///< A * r (recursively updated)
+    VectorType q;      ///< A * w
+    VectorType p;      ///< Search direction
+    VectorType s;      ///< A * p
+    VectorType z;      ///< A * s
+    VectorType err;    ///< Error x_true - x (analysis only)
+    VectorType Aerr;   ///< A * err (analysis only)
+
+    /// Allocate work vectors for a problem of size n (no-op if already sized)
+    /// @param error_vectors Also allocate err/Aerr (needed for error diagnostics)
+    void resize(Eigen::Index n, bool error_vectors = true) {
+        if (r.size() != n) {
+            r.resize(n);
+            w.resize(n);
+            q.resize(n);
+            p.resize(n);
+            s.resize(n);
+            z.resize(n);
+        }
+        if (error_vectors && err.size() != n) {
+            err.resize(n);
+            Aerr.resize(n);
+        }
+    }
+};
+
+/// Pipelined Conjugate Gradient (Ghysels and Vanroose, 2014)
+///
+/// Mathematically equivalent to conjugateGradient, but rearranged so that
+/// each iteration has a single global reduction: (r,r) and (w,r) are
+/// accumulated together, in the same sweep that updates all vectors
+/// (kernels::pipelined_update), and the step sizes are derived from them
+/// without (p,Ap). The SpMV q = A w needs no reduction, so an iteration is
+/// one SpMV sweep plus one fused vector sweep, with one synchronization.
+///
+/// The extra recurrences (w, s, z) make the recursive residual drift from
+/// the true residual sooner than in classic CG; compare true_relres_2 and the
+/// histories against conjugateGradient in the same precision.
+///
+/// @param A Symmetric positive definite matrix (anything with kernels::spmv/spmv_dot)
+/// @param b Right-hand side vector
+/// @param x Initial guess (modified in-place)
+/// @param x_true True solution for error analysis (unused unless diagnostics are Full)
+/// @param max_iter Maximum number of iterations
+/// @param tolerance Convergence tolerance for relative residual
+/// @param ws Work vectors (resized to A.rows() if needed)
+/// @param diagnostics Which convergence histories to record
+/// @return CGResult with the same histories as conjugateGradient
+template<typename T, typename MatrixType = typename bailey::PrecisionTraits<T>::matrix_type>
+CGResult<T> pipelinedConjugateGradient(
+    const MatrixType& A,
+    const typename bailey::PrecisionTraits<T>::vector_type& b,
+    typename bailey::PrecisionTraits<T>::vector_type& x,
+    const typename bailey::PrecisionTraits<T>::vector_type& x_true,
+    int max_iter,
+    double tolerance,
+    PipelinedCGWorkspace<T>& ws,
+    const DiagnosticsPolicy& diagnostics = {}
+) {
+    auto start_time = std::chrono::high_resolution_clock::now();
+
+    const bool track_residual = diagnostics.records_residual();
+    const bool track_error = diagnostics.records_error();
+    const int error_interval = std::max(1, diagnostics.interval);
+
+    ws.resize(A.rows(), track_error);
+    auto& r = ws.r;
+    auto& w = ws.w;
+    auto& q = ws.q;
+    auto& p = ws.p;
+    auto& s = ws.s;
+    auto& z = ws.z;
+    auto& err = ws.err;
+    auto& Aerr = ws.Aerr;
+
+    CGResult<T> result;
+    result.diagnostics = diagnostics;
+    result.reserve_history(max_iter + 1, max_iter / error_interval + 2);
+
+    T norm2_b = sqrt(kernels::dot<T>(b, b));
+    T norm2_x_true = T(0.0);
+    T normA_x_true = T(0.0);
+    if (track_error) {
+        norm2_x_true = sqrt(kernels::dot<T>(x_true, x_true));
+        normA_x_true = sqrt(kernels::spmv_dot<T>(A, x_true, Aerr));
+    }
+
+    auto record_error = [&](int iter) {
+        T err_dot = kernels::diff_dot<T>(x_true, x, err);
+        T err_A_dot = kernels::spmv_dot<T>(A, err, Aerr);
+        result.record_error(iter, to_double(sqrt(err_dot) / norm2_x_true),
+                            to_double(sqrt(err_A_dot) / normA_x_true));
+    };
+
+    // r = b - Ax, gamma = (r,r); w = A r, delta = (r,w)
+    kernels::spmv<T>(A, x, w);
+    T gamma = kernels::diff_dot<T>(b, w, r);
+    T delta = kernels::spmv_dot<T>(A, r, w);
+
+    T initial_residual_norm = sqrt(gamma);
+    double relres = to_double(initial_residual_norm / norm2_b);
+    result.initial_residual_norm = to_double(initial_residual_norm);
+    if (track_residual) {
+        result.record_residual(0, relres);
+    }
+    if (track_error) {
+        record_error(0);
+    }
+
+    // z, s, p start at zero so that the first update (beta = 0) sets p = r, s = w, z = q
+    z.setZero();
+    s.setZero();
+    p.setZero();
+
+    bool is_converged = false;
+    int iter_final = 0;
+    T gamma_old = T(0.0);
+    T alpha_old = T(0.0);
+
+    for (int iter = 1; iter <= max_iter; ++iter) {
+        // q = A w (no reduction)
+        kernels::spmv<T>(A, w, q);
+
+        // Step sizes from the fused reduction of the previous sweep
+        T beta = T(0.0);
+        T alpha = gamma / delta;
+        if (iter > 1) {
+            beta = gamma / gamma_old;
+            alpha = gamma / (delta - beta * gamma / alpha_old);
+        }
+
+        // All vector updates and the next (r,r), (w,r) in one sweep
+        auto dots = kernels::pipelined_update<T>(alpha, beta, q, z, s, p, x, r, w);
+        gamma_old = gamma;
+        alpha_old = alpha;
+        gamma = dots[0];
+        delta = dots[1];
+
+        relres = to_double(sqrt(gamma) / norm2_b);
+        is_converged = relres < tolerance;
+        iter_final = iter;
+
+        if (track_residual) {
+            result.record_residual(iter, relres);
+        }
+        if (track_error && (iter % error_interval == 0 || is_converged || iter == max_iter)) {
+            record_error(iter);
+        }
+
+        if (is_converged) {
+            break;
+        }
+    }
+
+    result.iterations_performed = iter_final;
+    result.converged = is_converged;
+    result.final_residual_norm = relres;
+
+    auto end_time = std::chrono::high_resolution_clock::now();
+    auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(end_time - start_time);
+    result.computation_time = duration.count() / 1000.0;
+
+    kernels::spmv<T>(A, x, q);
+    T true_residual_norm = sqrt(kernels::diff_dot<T>(b, q, q));
+    result.true_relres_2 = to_double(true_residual_norm / norm2_b);
+
+    return result;
+}
+
+/// Pipelined CG using a workspace local to this call
+///
+/// @see pipelinedConjugateGradient(A, b, x, x_true, max_iter, tolerance, ws, diagnostics)
+template<typename T, typename MatrixType = typename bailey::PrecisionTraits<T>::matrix_type>
+CGResult<T> pipelinedConjugateGradient(
+    const MatrixType& A,
+    const typename bailey::PrecisionTraits<T>::vector_type& b,
+    typename bailey::PrecisionTraits<T>::vector_type& x,
+    const typename bailey::PrecisionTraits<T>::vector_type& x_true,
+    int max_iter,
+    double tolerance,
+    const DiagnosticsPolicy& diagnostics = {}
+) {
+    PipelinedCGWorkspace<T> ws;
+    return pipelinedConjugateGradient<T, MatrixType>(A, b, x, x_true, max_iter, tolerance, ws, diagnostics);
+}
+
+} // namespace algorithms
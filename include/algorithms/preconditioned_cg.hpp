@@ -0,0 +1,160 @@
+#pragma once
+
+#include "algorithms/conjugate_gradient.hpp"
+#include "algorithms/preconditioners.hpp"
+
+namespace algorithms {
+
+/// Preconditioned Conjugate Gradient solver
+///
+/// Same interface, diagnostics and kernels as conjugateGradient, with the
+/// residual preconditioned by M (see preconditioners.hpp) every iteration.
+/// Convergence is still measured by the unpreconditioned relative residual
+/// ||r||_2 / ||b||_2, so histories are directly comparable with plain CG.
+/// Each iteration costs one apply of M and one extra dot product (r, z).
+///
+/// @param A Symmetric positive definite matrix (anything with kernels::spmv/spmv_dot)
+/// @param b Right-hand side vector
+/// @param x Initial guess (modified in-place)
+/// @param x_true True solution for error analysis (unused unless diagnostics are Full)
+/// @param M Symmetric positive definite preconditioner, z = M^{-1} r
+/// @param max_iter Maximum number of iterations
+/// @param tolerance Convergence tolerance for relative residual
+/// @param ws Work vectors (resized to A.rows() if needed, including z)
+/// @param diagnostics Which convergence histories to record
+/// @return CGResult containing convergence history and statistics
+template<typename T, typename MatrixType, typename Preconditioner>
+CGResult<T> preconditionedConjugateGradient(
+    const MatrixType& A,
+    const typename bailey::PrecisionTraits<T>::vector_type& b,
+    typename bailey::PrecisionTraits<T>::vector_type& x,
+    const typename bailey::PrecisionTraits<T>::vector_type& x_true,
+    const Preconditioner& M,
+    int max_iter,
+    double tolerance,
+    CGWorkspace<T>& ws,
+    const DiagnosticsPolicy& diagnostics = {}
+) {
+    static_assert(is_preconditioner_v<Preconditioner, T>,
+                  "Preconditioner must provide apply(r, z) and name()");
+
+    auto start_time = std::chrono::high_resolution_clock::now();
+
+    const bool track_residual = diagnostics.records_residual();
+    const bool track_error = diagnostics.records_error();
+    const int error_interval = std::max(1, diagnostics.interval);
+
+    ws.resize(A.rows(), track_error, true);
+    auto& r = ws.r;
+    auto& z = ws.z;
+    auto& p = ws.p;
+    auto& w = ws.w;
+    auto& err = ws.err;
+    auto& Aerr = ws.Aerr;
+
+    CGResult<T> result;
+    result.diagnostics = diagnostics;
+    result.reserve_history(max_iter + 1, max_iter / error_interval + 2);
+
+    T norm2_b = sqrt(kernels::dot<T>(b, b));
+    T norm2_x_true = T(0.0);
+    T normA_x_true = T(0.0);
+    if (track_error) {
+        norm2_x_true = sqrt(kernels::dot<T>(x_true, x_true));
+        normA_x_true = sqrt(kernels::spmv_dot<T>(A, x_true, Aerr));
+    }
+
+    auto record_error = [&](int iter) {
+        T err_dot = kernels::diff_dot<T>(x_true, x, err);
+        T err_A_dot = kernels::spmv_dot<T>(A, err, Aerr);
+        result.record_error(iter, to_double(sqrt(err_dot) / norm2_x_true),
+                            to_double(sqrt(err_A_dot) / normA_x_true));
+    };
+
+    // r = b - Ax, z = M^{-1} r, p = z
+    kernels::spmv<T>(A, x, w);
+    T rr = kernels::diff_dot<T>(b, w, r);
+    M.apply(r, z);
+    T rz_old = kernels::dot<T>(r, z);
+
+    T initial_residual_norm = sqrt(rr);
+    double relres = to_double(initial_residual_norm / norm2_b);
+    result.initial_residual_norm = to_double(initial_residual_norm);
+    if (track_residual) {
+        result.record_residual(0, relres);
+    }
+    if (track_error) {
+        record_error(0);
+    }
+
+    p = z;
+
+    bool is_converged = false;
+    int iter_final = 0;
+
+    for (int iter = 1; iter <= max_iter; ++iter) {
+        // α = (r,z) / (p,Ap)
+        T sigma = kernels::spmv_dot<T>(A, p, w);
+        T alpha = rz_old / sigma;
+
+        kernels::axpy<T>(alpha, p, x);
+        rr = kernels::axpy_dot<T>(alpha, w, r);
+
+        relres = to_double(sqrt(rr) / norm2_b);
+        is_converged = relres < tolerance;
+        iter_final = iter;
+
+        if (track_residual) {
+            result.record_residual(iter, relres);
+        }
+        if (track_error && (iter % error_interval == 0 || is_converged || iter == max_iter)) {
+            record_error(iter);
+        }
+
+        if (is_converged) {
+            break;
+        }
+
+        // z = M^{-1} r, β = (r_{k+1},z_{k+1}) / (r_k,z_k), p = z + β*p
+        M.apply(r, z);
+        T rz_new = kernels::dot<T>(r, z);
+        T beta = rz_new / rz_old;
+        rz_old = rz_new;
+        kernels::xpby<T>(z, beta, p);
+    }
+
+    result.iterations_performed = iter_final;
+    result.converged = is_converged;
+    result.final_residual_norm = relres;
+
+    auto end_time = std::chrono::high_resolution_clock::now();
+    auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(end_time - start_time);
+    result.computation_time = duration.count() / 1000.0;
+
+    kernels::spmv<T>(A, x, w);
+    T true_residual_norm = sqrt(kernels::diff_dot<T>(b, w, w));
+    result.true_relres_2 = to_double(true_residual_norm / norm2_b);
+
+    return result;
+}
+
+/// Preconditioned CG using a workspace local to this call
+///
+/// @see preconditionedConjugateGradient(A, b, x, x_true, M, max_iter, tolerance, ws, diagnostics)
+template<typename T, typename MatrixType, typename Preconditioner>
+CGResult<T> preconditionedConjugateGradient(
+    const MatrixType& A,
+    const typename bailey::PrecisionTraits<T>::vector_type& b,
+    typename bailey::PrecisionTraits<T>::vector_type& x,
+    const typename bailey::PrecisionTraits<T>::vector_type& x_true,
+    const Preconditioner& M,
+    int max_iter,
+    double tolerance,
+    const DiagnosticsPolicy& diagnostics = {}
+) {
+    CGWorkspace<T> ws;
+    return preconditionedConjugateGradient<T, MatrixType, Preconditioner>(A, b, x, x_true, M, max_iter,
+                                                                          tolerance, ws, diagnostics);
+}
+
+} // namespace algorithms
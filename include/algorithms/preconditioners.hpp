@@ -0,0 +1,319 @@
+#pragma once
+
+#include "bailey/precision_traits.hpp"
+#include "bailey/symmetric_csr.hpp"
+#include <Eigen/Sparse>
+#include <vector>
+#include <string>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+// ==============================================================================
+//  Preconditioners for PCG (preconditioned_cg.hpp)
+//
+//  A preconditioner for precision T is any type P with
+//
+//      void P::apply(const VectorType& r, VectorType& z) const;   // z = M^{-1} r
+//      const char* P::name() const;
+//
+//  where VectorType is PrecisionTraits<T>::vector_type (checked with
+//  is_preconditioner_v). apply() must not allocate, so PCG iterations stay
+//  allocation-free like plain CG.
+//
+//  All preconditioners here are built from the upper triangle (diagonal
+//  included) of a symmetric matrix in full CSR or symmetric storage, with
+//  values of the solver precision T or double (mixed storage); their data is
+//  held and applied in T.
+// ==============================================================================
+
+namespace algorithms {
+
+/// Preconditioner selected on the command line
+enum class PreconditionerType {
+    None,     ///< Plain CG
+    Jacobi,   ///< M = diag(A)
+    SSOR,     ///< Symmetric successive over-relaxation
+    IC0       ///< Incomplete Cholesky with the sparsity pattern of A
+};
+
+inline const char* to_string(PreconditionerType type) {
+    switch (type) {
+        case PreconditionerType::None:   return "none";
+        case PreconditionerType::Jacobi: return "jacobi";
+        case PreconditionerType::SSOR:   return "ssor";
+        case PreconditionerType::IC0:    return "ic0";
+    }
+    return "unknown";
+}
+
+inline PreconditionerType parse_preconditioner_type(const std::string& name) {
+    if (name == "none") return PreconditionerType::None;
+    if (name == "jacobi") return PreconditionerType::Jacobi;
+    if (name == "ssor") return PreconditionerType::SSOR;
+    if (name == "ic0") return PreconditionerType::IC0;
+    throw std::runtime_error("Invalid preconditioner. Use: none, jacobi, ssor, or ic0");
+}
+
+/// Detects the preconditioner interface described above
+template<typename P, typename T, typename = void>
+struct is_preconditioner : std::false_type {};
+
+template<typename P, typename T>
+struct is_preconditioner<P, T, std::void_t<
+    decltype(std::declval<const P&>().apply(
+        std::declval<const typename bailey::PrecisionTraits<T>::vector_type&>(),
+        std::declval<typename bailey::PrecisionTraits<T>::vector_type&>())),
+    decltype(std::declval<const P&>().name())>> : std::true_type {};
+
+template<typename P, typename T>
+inline constexpr bool is_preconditioner_v = is_preconditioner<P, T>::value;
+
+namespace detail {
+
+/// Upper triangle of a symmetric matrix in CSR form, values in T
+///
+/// Each row starts with its diagonal entry, followed by the strictly upper
+/// entries in ascending column order.
+template<typename T>
+struct UpperCsr {
+    int n{0};
+    std::vector<int> outer;
+    std::vector<int> inner;
+    std::vector<T> values;
+};
+
+/// Extract the upper triangle of a full row-major CSR matrix
+template<typename T, typename V>
+UpperCsr<T> upper_triangle(const Eigen::SparseMatrix<V, Eigen::RowMajor>& A) {
+    eigen_assert(A.isCompressed());
+    UpperCsr<T> U;
+    U.n = static_cast<int>(A.rows());
+    U.outer.assign(U.n + 1, 0);
+
+    const auto* outer = A.outerIndexPtr();
+    const auto* inner = A.innerIndexPtr();
+    const V* values = A.valuePtr();
+    for (int i = 0; i < U.n; ++i) {
+        bool has_diagonal = false;
+        for (auto k = outer[i]; k < outer[i + 1]; ++k) {
+            if (inner[k] >= i) {
+                has_diagonal |= inner[k] == i;
+                U.inner.push_back(inner[k]);
+                U.values.push_back(T(values[k]));
+            }
+        }
+        if (!has_diagonal || U.inner[U.outer[i]] != i) {
+            throw std::runtime_error("Preconditioner requires a diagonal entry in every row");
+        }
+        U.outer[i + 1] = static_cast<int>(U.inner.size());
+    }
+    return U;
+}
+
+/// Upper triangle of a symmetric-storage matrix (already stored that way)
+template<typename T, typename V>
+UpperCsr<T> upper_triangle(const bailey::SymmetricCsrMatrix<V>& A) {
+    UpperCsr<T> U;
+    U.n = static_cast<int>(A.rows());
+    U.outer.assign(A.upperOuter(), A.upperOuter() + U.n + 1);
+    U.inner.assign(A.upperInner(), A.upperInner() + A.storedNonZeros());
+    U.values.resize(A.storedNonZeros());
+    for (std::size_t k = 0; k < U.values.size(); ++k) {
+        U.values[k] = T(A.values()[k]);
+    }
+    for (int i = 0; i < U.n; ++i) {
+        if (U.outer[i] == U.outer[i + 1] || U.inner[U.outer[i]] != i) {
+            throw std::runtime_error("Preconditioner requires a diagonal entry in every row");
+        }
+    }
+    return U;
+}
+
+/// z = R^{-1} S R^{-T} r for an upper triangular R and a diagonal S
+///
+/// R has the strictly upper part of U and the diagonal 1 / inv_diag; S is
+/// `scale` (identity if empty). The forward sweep R^T y = r scatters along
+/// the rows of U, the backward sweep R z = S y gathers; both run in place in
+/// z, sequentially.
+template<typename T, typename VectorType>
+void triangular_solves(const UpperCsr<T>& U, const std::vector<T>& inv_diag, const std::vector<T>& scale,
+                       const VectorType& r, VectorType& z) {
+    const int n = U.n;
+    z = r;
+    for (int i = 0; i < n; ++i) {
+        const T zi = T(z[i]) * inv_diag[i];
+        z[i] = zi;
+        for (int k = U.outer[i] + 1; k < U.outer[i + 1]; ++k) {
+            z[U.inner[k]] -= U.values[k] * zi;
+        }
+    }
+    if (!scale.empty()) {
+        for (int i = 0; i < n; ++i) {
+            z[i] = T(z[i]) * scale[i];
+        }
+    }
+    for (int i = n - 1; i >= 0; --i) {
+        T sum = z[i];
+        for (int k = U.outer[i] + 1; k < U.outer[i + 1]; ++k) {
+            sum -= U.values[k] * T(z[U.inner[k]]);
+        }
+        z[i] = sum * inv_diag[i];
+    }
+}
+
+} // namespace detail
+
+/// Jacobi (diagonal) preconditioner: z = D^{-1} r
+template<typename T>
+class JacobiPreconditioner {
+public:
+    using VectorType = typename bailey::PrecisionTraits<T>::vector_type;
+
+    template<typename MatrixType>
+    explicit JacobiPreconditioner(const MatrixType& A) {
+        auto U = detail::upper_triangle<T>(A);
+        inv_diag_.resize(U.n);
+        for (int i = 0; i < U.n; ++i) {
+            inv_diag_[i] = T(1.0) / U.values[U.outer[i]];
+        }
+    }
+
+    void apply(const VectorType& r, VectorType& z) const {
+        #pragma omp parallel for schedule(static)
+        for (Eigen::Index i = 0; i < r.size(); ++i) {
+            z[i] = T(r[i]) * inv_diag_[i];
+        }
+    }
+
+    const char* name() const { return "jacobi"; }
+
+private:
+    std::vector<T> inv_diag_;
+};
+
+/// SSOR preconditioner
+///
+/// M = omega/(2-omega) (D/omega + L) D^{-1} (D/omega + U) with U = L^T.
+/// omega = 1 gives symmetric Gauss-Seidel. The triangular sweeps are
+/// sequential.
+template<typename T>
+class SSORPreconditioner {
+public:
+    using VectorType = typename bailey::PrecisionTraits<T>::vector_type;
+
+    template<typename MatrixType>
+    SSORPreconditioner(const MatrixType& A, double omega) : U_(detail::upper_triangle<T>(A)) {
+        if (!(omega > 0.0 && omega < 2.0)) {
+            throw std::runtime_error("SSOR relaxation factor must be in (0, 2)");
+        }
+        const T w(omega);
+        const T middle = (T(2.0) - w) / w;
+        inv_diag_.resize(U_.n);
+        scale_.resize(U_.n);
+        for (int i = 0; i < U_.n; ++i) {
+            const T d = U_.values[U_.outer[i]];
+            inv_diag_[i] = w / d;       // (D/omega)^{-1}
+            scale_[i] = d * middle;     // D (2-omega)/omega
+        }
+    }
+
+    void apply(const VectorType& r, VectorType& z) const {
+        detail::triangular_solves(U_, inv_diag_, scale_, r, z);
+    }
+
+    const char* name() const { return "ssor"; }
+
+private:
+    detail::UpperCsr<T> U_;
+    std::vector<T> inv_diag_;
+    std::vector<T> scale_;
+};
+
+/// Incomplete Cholesky IC(0) preconditioner: M = R^T R
+///
+/// R is upper triangular with the sparsity pattern of the upper triangle of
+/// A. If a pivot becomes non-positive, the factorization is restarted on
+/// A + shift * diag(A) with shift = 1e-3, 2e-3, 4e-3, ... (Manteuffel shift);
+/// the shift used is reported by shift().
+template<typename T>
+class IC0Preconditioner {
+public:
+    using VectorType = typename bailey::PrecisionTraits<T>::vector_type;
+
+    template<typename MatrixType>
+    explicit IC0Preconditioner(const MatrixType& A) {
+        const detail::UpperCsr<T> source = detail::upper_triangle<T>(A);
+        for (int attempt = 0; attempt < max_attempts; ++attempt) {
+            if (factorize(source)) {
+                return;
+            }
+            shift_ = shift_ == 0.0 ? 1.0e-3 : 2.0 * shift_;
+        }
+        throw std::runtime_error("IC(0) factorization failed (non-positive pivots even with diagonal shift)");
+    }
+
+    void apply(const VectorType& r, VectorType& z) const {
+        detail::triangular_solves(R_, inv_diag_, no_scale_, r, z);
+    }
+
+    const char* name() const { return "ic0"; }
+
+    /// Relative diagonal shift needed for a positive factorization (0 if none)
+    double shift() const { return shift_; }
+
+private:
+    static constexpr int max_attempts = 20;
+
+    /// Row-oriented IC(0) on a copy of the upper triangle; false on breakdown
+    bool factorize(const detail::UpperCsr<T>& source) {
+        R_ = source;
+        const int n = R_.n;
+        if (shift_ != 0.0) {
+            const T factor = T(1.0) + T(shift_);
+            for (int i = 0; i < n; ++i) {
+                R_.values[R_.outer[i]] = R_.values[R_.outer[i]] * factor;
+            }
+        }
+
+        inv_diag_.resize(n);
+        std::vector<int> position(n, -1);   // column -> index in the row being updated
+        for (int k = 0; k < n; ++k) {
+            const int diag = R_.outer[k];
+            if (!(to_double(R_.values[diag]) > 0.0)) {
+                return false;
+            }
+            const T pivot = sqrt(R_.values[diag]);
+            R_.values[diag] = pivot;
+            inv_diag_[k] = T(1.0) / pivot;
+            for (int m = diag + 1; m < R_.outer[k + 1]; ++m) {
+                R_.values[m] = R_.values[m] * inv_diag_[k];
+            }
+
+            // Update the trailing rows i > k touched by row k, within their pattern
+            for (int m = diag + 1; m < R_.outer[k + 1]; ++m) {
+                const int i = R_.inner[m];
+                for (int q = R_.outer[i]; q < R_.outer[i + 1]; ++q) {
+                    position[R_.inner[q]] = q;
+                }
+                for (int t = m; t < R_.outer[k + 1]; ++t) {
+                    const int q = position[R_.inner[t]];
+                    if (q >= 0) {
+                        R_.values[q] -= R_.values[m] * R_.values[t];
+                    }
+                }
+                for (int q = R_.outer[i]; q < R_.outer[i + 1]; ++q) {
+                    position[R_.inner[q]] = -1;
+                }
+            }
+        }
+        return true;
+    }
+
+    detail::UpperCsr<T> R_;
+    std::vector<T> inv_diag_;
+    std::vector<T> no_scale_;
+    double shift_{0.0};
+};
+
+} // namespace algorithms
@@ -0,0 +1,309 @@
+#pragma once
+
+#include "algorithms/conjugate_gradient.hpp"
+#include <vector>
+#include <stdexcept>
+
+namespace algorithms {
+
+/// Largest s accepted by sstepConjugateGradient (2s+1 basis vectors)
+inline constexpr int max_sstep = 16;
+
+/// Preallocated work vectors and small dense buffers for sstepConjugateGradient
+template<typename T>
+struct SStepCGWorkspace {
+    using VectorType = typename bailey::PrecisionTraits<T>::vector_type;
+
+    /// Krylov basis [p, Ap, ..., A^s p, r, Ar, ..., A^{s-1} r]; Y[0] is the
+    /// search direction and Y[s+1] the residual between outer steps
+    std::vector<VectorType> Y;
+    VectorType w;      ///< A * x (initial and true residual)
+    VectorType err;    ///< Error x_true - x (analysis only)
+    VectorType Aerr;   ///< A * err (analysis only)
+
+    std::vector<T> G;          ///< Gram matrix Y^T Y (row-major)
+    std::vector<T> G_packed;   ///< Upper triangle of G as reduced
+    std::vector<T> cx;         ///< Coefficients of the x update in the basis
+    std::vector<T> cr;         ///< Coefficients of r in the basis
+    std::vector<T> cp;         ///< Coefficients of p in the basis
+    std::vector<T> cw;         ///< Coefficients of A p in the basis
+    std::vector<T> Gv;         ///< G times a coefficient vector
+    bailey_blas::ReduceScratch<T> scratch;
+
+    /// Allocate work vectors for a problem of size n and block size s
+    /// (no-op if already sized)
+    /// @param error_vectors Also allocate err/Aerr (needed for error diagnostics)
+    void resize(Eigen::Index n, int s, bool error_vectors = true) {
+        const std::size_t d = 2 * static_cast<std::size_t>(s) + 1;
+        if (Y.size() != d) {
+            Y.resize(d);
+        }
+        for (auto& y : Y) {
+            if (y.size() != n) {
+                y.resize(n);
+            }
+        }
+        if (w.size() != n) {
+            w.resize(n);
+        }
+        if (error_vectors && err.size() != n) {
+            err.resize(n);
+            Aerr.resize(n);
+        }
+        G.resize(d * d);
+        G_packed.resize(d * (d + 1) / 2);
+        cx.resize(d);
+        cr.resize(d);
+        cp.resize(d);
+        cw.resize(d);
+        Gv.resize(d);
+    }
+};
+
+namespace detail {
+
+/// u^T G v for a small dense row-major d x d matrix G (Gv is scratch)
+template<typename T>
+T gram_product(const std::vector<T>& G, const std::vector<T>& u, const std::vector<T>& v,
+               std::vector<T>& Gv) {
+    const std::size_t d = u.size();
+    for (std::size_t j = 0; j < d; ++j) {
+        T sum = T(0.0);
+        for (std::size_t l = 0; l < d; ++l) {
+            sum += G[j * d + l] * v[l];
+        }
+        Gv[j] = sum;
+    }
+    T result = T(0.0);
+    for (std::size_t j = 0; j < d; ++j) {
+        result += u[j] * Gv[j];
+    }
+    return result;
+}
+
+} // namespace detail
+
+/// s-step (communication-avoiding) Conjugate Gradient
+///
+/// CA-CG of Carson and Demmel with a monomial basis. Each outer step builds
+/// the basis Y = [p, Ap, ..., A^s p, r, Ar, ..., A^{s-1} r] with 2s-1
+/// consecutive SpMVs (the matrix powers kernel, without ghost-zone
+/// blocking), reduces the whole Gram matrix Y^T Y in one sweep
+/// (kernels::gram) and then runs s CG iterations on coefficient vectors of
+/// length 2s+1, where A acts as a shift of the basis and every dot product
+/// is u^T G v. x, r and p are recovered from the coefficients in one fused
+/// sweep (kernels::block_combine). One global reduction per s iterations
+/// replaces the 2s of classic CG.
+///
+/// The Gram matrix is reduced in T, so DD/DQ/QX keep the monomial basis
+/// usable to larger s than double, whose residual history departs from
+/// classic CG (and may stagnate) as s grows; compare hist_relres_2 against
+/// conjugateGradient in the same precision. If rounding makes r^T G r
+/// non-positive, the residual is recomputed explicitly and the method
+/// restarts with p = r.
+///
+/// hist_relres_2 has one entry per CG iteration (from r^T G r); error norms
+/// can only be measured on recovered vectors, so hist_relerr_* are recorded
+/// at outer step boundaries when at least diagnostics.interval iterations
+/// have passed since the last entry (and on convergence / max_iter).
+///
+/// @param A Symmetric positive definite matrix (anything with kernels::spmv/spmv_dot)
+/// @param b Right-hand side vector
+/// @param x Initial guess (modified in-place)
+/// @param x_true True solution for error analysis (unused unless diagnostics are Full)
+/// @param s Iterations per outer step, 1 <= s <= max_sstep
+/// @param max_iter Maximum number of iterations
+/// @param tolerance Convergence tolerance for relative residual
+/// @param ws Work vectors (resized to A.rows() and s if needed)
+/// @param diagnostics Which convergence histories to record
+/// @return CGResult with the same histories as conjugateGradient
+template<typename T, typename MatrixType = typename bailey::PrecisionTraits<T>::matrix_type>
+CGResult<T> sstepConjugateGradient(
+    const MatrixType& A,
+    const typename bailey::PrecisionTraits<T>::vector_type& b,
+    typename bailey::PrecisionTraits<T>::vector_type& x,
+    const typename bailey::PrecisionTraits<T>::vector_type& x_true,
+    int s,
+    int max_iter,
+    double tolerance,
+    SStepCGWorkspace<T>& ws,
+    const DiagnosticsPolicy& diagnostics = {}
+) {
+    if (s < 1 || s > max_sstep) {
+        throw std::runtime_error("s-step CG requires 1 <= s <= " + std::to_string(max_sstep));
+    }
+
+    auto start_time = std::chrono::high_resolution_clock::now();
+
+    const bool track_residual = diagnostics.records_residual();
+    const bool track_error = diagnostics.records_error();
+    const int error_interval = std::max(1, diagnostics.interval);
+
+    ws.resize(A.rows(), s, track_error);
+    const std::size_t d = ws.Y.size();
+    auto& Y = ws.Y;
+    auto& P = Y[0];
+    auto& R = Y[s + 1];
+    auto& w = ws.w;
+    auto& err = ws.err;
+    auto& Aerr = ws.Aerr;
+    auto& G = ws.G;
+    auto& cx = ws.cx;
+    auto& cr = ws.cr;
+    auto& cp = ws.cp;
+    auto& cw = ws.cw;
+
+    CGResult<T> result;
+    result.diagnostics = diagnostics;
+    result.reserve_history(max_iter + 1, max_iter / error_interval + max_iter / s + 2);
+
+    T norm2_b = sqrt(kernels::dot<T>(b, b));
+    T norm2_x_true = T(0.0);
+    T normA_x_true = T(0.0);
+    if (track_error) {
+        norm2_x_true = sqrt(kernels::dot<T>(x_true, x_true));
+        normA_x_true = sqrt(kernels::spmv_dot<T>(A, x_true, Aerr));
+    }
+
+    int last_error_iter = 0;
+    auto record_error = [&](int iter) {
+        T err_dot = kernels::diff_dot<T>(x_true, x, err);
+        T err_A_dot = kernels::spmv_dot<T>(A, err, Aerr);
+        result.record_error(iter, to_double(sqrt(err_dot) / norm2_x_true),
+                            to_double(sqrt(err_A_dot) / normA_x_true));
+        last_error_iter = iter;
+    };
+
+    // r = b - Ax, p = r
+    kernels::spmv<T>(A, x, w);
+    T rr = kernels::diff_dot<T>(b, w, R);
+    P = R;
+
+    T initial_residual_norm = sqrt(rr);
+    double relres = to_double(initial_residual_norm / norm2_b);
+    result.initial_residual_norm = to_double(initial_residual_norm);
+    if (track_residual) {
+        result.record_residual(0, relres);
+    }
+    if (track_error) {
+        record_error(0);
+    }
+
+    bool is_converged = false;
+    int iter = 0;
+
+    while (iter < max_iter && !is_converged) {
+        // Matrix powers: A^j p for j = 1..s, A^j r for j = 1..s-1
+        for (int j = 0; j < s; ++j) {
+            kernels::spmv<T>(A, Y[j], Y[j + 1]);
+        }
+        for (int j = 0; j + 1 < s; ++j) {
+            kernels::spmv<T>(A, Y[s + 1 + j], Y[s + 2 + j]);
+        }
+
+        // The only global reduction of this outer step
+        kernels::gram<T>(Y, ws.scratch, ws.G_packed, G);
+
+        std::fill(cx.begin(), cx.end(), T(0.0));
+        std::fill(cr.begin(), cr.end(), T(0.0));
+        std::fill(cp.begin(), cp.end(), T(0.0));
+        cr[s + 1] = T(1.0);
+        cp[0] = T(1.0);
+        T rr_old = G[(s + 1) * d + (s + 1)];
+        bool restart = false;
+
+        for (int k = 0; k < s && iter < max_iter; ++k) {
+            // cw = B cp: A maps A^j p to A^{j+1} p and A^j r to A^{j+1} r
+            std::fill(cw.begin(), cw.end(), T(0.0));
+            for (int j = 0; j < s; ++j) {
+                cw[j + 1] = cp[j];
+            }
+            for (int j = 0; j + 1 < s; ++j) {
+                cw[s + 2 + j] = cp[s + 1 + j];
+            }
+
+            // α = (r,r) / (p,Ap)
+            T alpha = rr_old / detail::gram_product(G, cp, cw, ws.Gv);
+            for (std::size_t j = 0; j < d; ++j) {
+                cx[j] += alpha * cp[j];
+                cr[j] -= alpha * cw[j];
+            }
+            T rr_new = detail::gram_product(G, cr, cr, ws.Gv);
+            ++iter;
+
+            if (!(to_double(rr_new) > 0.0)) {
+                restart = true;
+                break;
+            }
+
+            relres = to_double(sqrt(rr_new) / norm2_b);
+            is_converged = relres < tolerance;
+            if (track_residual) {
+                result.record_residual(iter, relres);
+            }
+            if (is_converged) {
+                break;
+            }
+
+            // β = (r_{k+1},r_{k+1}) / (r_k,r_k), p = r + β*p
+            T beta = rr_new / rr_old;
+            rr_old = rr_new;
+            for (std::size_t j = 0; j < d; ++j) {
+                cp[j] = cr[j] + beta * cp[j];
+            }
+        }
+
+        // x += Y cx, r = Y cr, p = Y cp
+        kernels::block_combine<T>(Y, cx, cr, cp, x, R, P);
+
+        if (restart) {
+            // Gram residual lost positivity: measure r directly and restart with p = r
+            rr = kernels::dot<T>(R, R);
+            relres = to_double(sqrt(rr) / norm2_b);
+            is_converged = relres < tolerance;
+            if (track_residual) {
+                result.record_residual(iter, relres);
+            }
+            P = R;
+        }
+
+        if (track_error &&
+            (iter - last_error_iter >= error_interval || is_converged || iter == max_iter)) {
+            record_error(iter);
+        }
+    }
+
+    result.iterations_performed = iter;
+    result.converged = is_converged;
+    result.final_residual_norm = relres;
+
+    auto end_time = std::chrono::high_resolution_clock::now();
+    auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(end_time - start_time);
+    result.computation_time = duration.count() / 1000.0;
+
+    kernels::spmv<T>(A, x, w);
+    T true_residual_norm = sqrt(kernels::diff_dot<T>(b, w, w));
+    result.true_relres_2 = to_double(true_residual_norm / norm2_b);
+
+    return result;
+}
+
+/// s-step CG using a workspace local to this call
+///
+/// @see sstepConjugateGradient(A, b, x, x_true, s, max_iter, tolerance, ws, diagnostics)
+template<typename T, typename MatrixType = typename bailey::PrecisionTraits<T>::matrix_type>
+CGResult<T> sstepConjugateGradient(
+    const MatrixType& A,
+    const typename bailey::PrecisionTraits<T>::vector_type& b,
+    typename bailey::PrecisionTraits<T>::vector_type& x,
+    const typename bailey::PrecisionTraits<T>::vector_type& x_true,
+    int s,
+    int max_iter,
+    double tolerance,
+    const DiagnosticsPolicy& diagnostics = {}
+) {
+    SStepCGWorkspace<T> ws;
+    return sstepConjugateGradient<T, MatrixType>(A, b, x, x_true, s, max_iter, tolerance, ws, diagnostics);
+}
+
+} // namespace algorithms
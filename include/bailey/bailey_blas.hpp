@@ -2,33 +2,322 @@
 
 #include "precision_traits.hpp"
 #include <vector>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <algorithm>
+
+#ifdef BAILEY_BLAS_USE_CBLAS
+#include <cblas.h>
+#endif
 
 namespace bailey_blas {
 
+// ==============================================================================
+//  Deterministic parallel reduction
+//
+//  [0, n) is split into a fixed number of chunks whose bounds depend only on n.
+//  Threads (OpenMP, if enabled) accumulate whole chunks into per-chunk partial
+//  sums; the partials are then combined by a fixed pairwise tree. The
+//  summation order therefore never depends on the thread count or schedule,
+//  and results are bitwise reproducible across runs and machines.
+// ==============================================================================
+
+/// Number of reduction chunks (power of two, independent of the thread count)
+inline constexpr std::size_t reduction_chunks = 256;
+
+/// First index of chunk c when [0, n) is split into reduction_chunks parts
+inline std::size_t chunk_begin(std::size_t n, std::size_t c) {
+    return n * c / reduction_chunks;
+}
+
+/// Chunk-local accumulator: plain summation for Bailey types, whose own
+/// arithmetic already carries the extra precision
+template<typename T>
+struct Accumulator {
+    T sum = T(0.0);
+
+    void add(const T& value) { sum += value; }
+    T value() const { return sum; }
+};
+
+/// double: Neumaier-compensated summation (rounding error of each addition
+/// is carried in a separate term and folded in at the end)
+template<>
+struct Accumulator<double> {
+    double sum = 0.0;
+    double comp = 0.0;
+
+    void add(double value) {
+        double t = sum + value;
+        if (std::abs(sum) >= std::abs(value)) {
+            comp += (sum - t) + value;
+        } else {
+            comp += (value - t) + sum;
+        }
+        sum = t;
+    }
+    double value() const { return sum + comp; }
+};
+
+/// Deterministic parallel reduction over [0, n)
+///
+/// @param n Number of elements
+/// @param body Callable (begin, end, Accumulator<T>&) adding the terms of one chunk
+/// @return Sum of all terms, bitwise independent of the thread count
+template<typename T, typename Body>
+T reduce(std::size_t n, Body body) {
+    std::array<T, reduction_chunks> partial;
+
+    #pragma omp parallel for schedule(dynamic)
+    for (std::size_t c = 0; c < reduction_chunks; ++c) {
+        Accumulator<T> acc;
+        body(chunk_begin(n, c), chunk_begin(n, c + 1), acc);
+        partial[c] = acc.value();
+    }
+
+    // Fixed pairwise tree: ((p0+p1)+(p2+p3)) + ...
+    for (std::size_t width = 1; width < reduction_chunks; width *= 2) {
+        for (std::size_t c = 0; c + width < reduction_chunks; c += 2 * width) {
+            partial[c] = partial[c] + partial[c + width];
+        }
+    }
+    return partial[0];
+}
+
+/// Deterministic parallel reduction of K sums in one sweep over [0, n)
+///
+/// Same chunking and combination order as reduce(), applied to each of the
+/// K sums, so fusing several dot products never changes their values.
+///
+/// @param body Callable (begin, end, std::array<Accumulator<T>, K>&) adding the terms of one chunk
+/// @return The K sums
+template<typename T, std::size_t K, typename Body>
+std::array<T, K> reduce_multi(std::size_t n, Body body) {
+    std::array<std::array<T, K>, reduction_chunks> partial;
+
+    #pragma omp parallel for schedule(dynamic)
+    for (std::size_t c = 0; c < reduction_chunks; ++c) {
+        std::array<Accumulator<T>, K> acc;
+        body(chunk_begin(n, c), chunk_begin(n, c + 1), acc);
+        for (std::size_t k = 0; k < K; ++k) {
+            partial[c][k] = acc[k].value();
+        }
+    }
+
+    for (std::size_t width = 1; width < reduction_chunks; width *= 2) {
+        for (std::size_t c = 0; c + width < reduction_chunks; c += 2 * width) {
+            for (std::size_t k = 0; k < K; ++k) {
+                partial[c][k] = partial[c][k] + partial[c + width][k];
+            }
+        }
+    }
+    return partial[0];
+}
+
+/// Scratch space for reduce_many (kept by the caller, so repeated reductions
+/// of the same size do not allocate)
+template<typename T>
+struct ReduceScratch {
+    std::vector<Accumulator<T>> acc;
+    std::vector<T> partial;
+};
+
+/// Deterministic parallel reduction of m sums, m known only at runtime
+///
+/// Same chunking and combination order as reduce() for each sum.
+///
+/// @param body Callable (begin, end, Accumulator<T>* acc) adding the terms of one chunk to acc[0..m)
+/// @param out Receives the m sums
+template<typename T, typename Body>
+void reduce_many(std::size_t n, std::size_t m, ReduceScratch<T>& scratch, T* out, Body body) {
+    scratch.acc.resize(reduction_chunks * m);
+    scratch.partial.resize(reduction_chunks * m);
+    std::fill(scratch.acc.begin(), scratch.acc.end(), Accumulator<T>{});
+
+    #pragma omp parallel for schedule(dynamic)
+    for (std::size_t c = 0; c < reduction_chunks; ++c) {
+        Accumulator<T>* acc = scratch.acc.data() + c * m;
+        body(chunk_begin(n, c), chunk_begin(n, c + 1), acc);
+        for (std::size_t k = 0; k < m; ++k) {
+            scratch.partial[c * m + k] = acc[k].value();
+        }
+    }
+
+    T* partial = scratch.partial.data();
+    for (std::size_t width = 1; width < reduction_chunks; width *= 2) {
+        for (std::size_t c = 0; c + width < reduction_chunks; c += 2 * width) {
+            for (std::size_t k = 0; k < m; ++k) {
+                partial[c * m + k] = partial[c * m + k] + partial[(c + width) * m + k];
+            }
+        }
+    }
+    std::copy(partial, partial + m, out);
+}
+
+/// Apply body(begin, end) to the reduction chunks of [0, n) in parallel
+///
+/// Element-wise counterpart of reduce(): lets a chunk be handed to an
+/// array-level kernel in one call.
+template<typename Body>
+void for_chunks(std::size_t n, Body body) {
+    #pragma omp parallel for schedule(dynamic)
+    for (std::size_t c = 0; c < reduction_chunks; ++c) {
+        body(chunk_begin(n, c), chunk_begin(n, c + 1));
+    }
+}
+
+// ==============================================================================
+//  Array-level Fortran kernels
+//
+//  The scalar wrappers of interfaces/bailey_wrappers cost one C->Fortran call
+//  (plus limb packing) per flop. VectorKernels<T> exposes the array routines
+//  of the same wrappers, which loop over a whole range inside Fortran. Each
+//  routine performs the same operations in the same order as the element-wise
+//  C++ loop it replaces (sums start from zero and add terms in index order),
+//  so dispatching to them never changes a result.
+//
+//  available is false for double and for DD/QX with an inline backend
+//  (BAILEY_DD_INLINE, BAILEY_QX_INLINE), where the element-wise loops make no
+//  Fortran calls.
+// ==============================================================================
+
+template<typename T>
+struct VectorKernels {
+    static constexpr bool available = false;
+};
+
+#ifndef BAILEY_DD_INLINE
+template<>
+struct VectorKernels<bailey::DDNumber> {
+    static_assert(sizeof(bailey::DDNumber) == 2 * sizeof(double), "DDNumber must be two packed limbs");
+    static constexpr bool available = true;
+
+    static const double* limbs(const bailey::DDNumber* x) { return reinterpret_cast<const double*>(x); }
+    static double* limbs(bailey::DDNumber* x) { return reinterpret_cast<double*>(x); }
+
+    /// y = y + alpha * x over n elements
+    static void axpy(std::size_t n, const bailey::DDNumber& alpha, const bailey::DDNumber* x, bailey::DDNumber* y) {
+        const int m = static_cast<int>(n);
+        ddaxpy_(&m, alpha.dd, limbs(x), limbs(y));
+    }
+
+    /// Sum of x[i] * y[i] over n elements, in index order from zero
+    static bailey::DDNumber dot(std::size_t n, const bailey::DDNumber* x, const bailey::DDNumber* y) {
+        const int m = static_cast<int>(n);
+        bailey::DDNumber s;
+        dddot_(&m, limbs(x), limbs(y), s.dd);
+        return s;
+    }
+
+    /// Rows [begin, end) of w = A * p for 0-based CSR arrays (DD values)
+    static void spmv_csr(int begin, int end, const int* outer, const int* inner,
+                         const bailey::DDNumber* values, const bailey::DDNumber* p, bailey::DDNumber* w) {
+        ddspmv_csr_(&begin, &end, outer, inner, limbs(values), limbs(p), limbs(w));
+    }
+
+    /// Rows [begin, end) of w = A * p for 0-based CSR arrays (double values)
+    static void spmv_csr(int begin, int end, const int* outer, const int* inner,
+                         const double* values, const bailey::DDNumber* p, bailey::DDNumber* w) {
+        ddspmv_csrd_(&begin, &end, outer, inner, values, limbs(p), limbs(w));
+    }
+};
+#endif // BAILEY_DD_INLINE
+
+template<>
+struct VectorKernels<bailey::DQNumber> {
+    static_assert(sizeof(bailey::DQNumber) == 2 * sizeof(long double), "DQNumber must be two packed limbs");
+    static constexpr bool available = true;
+
+    static const long double* limbs(const bailey::DQNumber* x) { return reinterpret_cast<const long double*>(x); }
+    static long double* limbs(bailey::DQNumber* x) { return reinterpret_cast<long double*>(x); }
+
+    static void axpy(std::size_t n, const bailey::DQNumber& alpha, const bailey::DQNumber* x, bailey::DQNumber* y) {
+        const int m = static_cast<int>(n);
+        dqaxpy_(&m, alpha.dq, limbs(x), limbs(y));
+    }
+
+    static bailey::DQNumber dot(std::size_t n, const bailey::DQNumber* x, const bailey::DQNumber* y) {
+        const int m = static_cast<int>(n);
+        bailey::DQNumber s;
+        dqdot_(&m, limbs(x), limbs(y), s.dq);
+        return s;
+    }
+
+    static void spmv_csr(int begin, int end, const int* outer, const int* inner,
+                         const bailey::DQNumber* values, const bailey::DQNumber* p, bailey::DQNumber* w) {
+        dqspmv_csr_(&begin, &end, outer, inner, limbs(values), limbs(p), limbs(w));
+    }
+
+    static void spmv_csr(int begin, int end, const int* outer, const int* inner,
+                         const double* values, const bailey::DQNumber* p, bailey::DQNumber* w) {
+        dqspmv_csrd_(&begin, &end, outer, inner, values, limbs(p), limbs(w));
+    }
+};
+
+#ifndef BAILEY_QX_INLINE
+template<>
+struct VectorKernels<bailey::QXNumber> {
+    static_assert(sizeof(bailey::QXNumber) == sizeof(long double), "QXNumber must be a single long double");
+    static constexpr bool available = true;
+
+    static const long double* limbs(const bailey::QXNumber* x) { return reinterpret_cast<const long double*>(x); }
+    static long double* limbs(bailey::QXNumber* x) { return reinterpret_cast<long double*>(x); }
+
+    static void axpy(std::size_t n, const bailey::QXNumber& alpha, const bailey::QXNumber* x, bailey::QXNumber* y) {
+        const int m = static_cast<int>(n);
+        qxaxpy_(&m, alpha.get_qx_ptr(), limbs(x), limbs(y));
+    }
+
+    static bailey::QXNumber dot(std::size_t n, const bailey::QXNumber* x, const bailey::QXNumber* y) {
+        const int m = static_cast<int>(n);
+        bailey::QXNumber s;
+        qxdot_(&m, limbs(x), limbs(y), s.get_qx_ptr());
+        return s;
+    }
+
+    static void spmv_csr(int begin, int end, const int* outer, const int* inner,
+                         const bailey::QXNumber* values, const bailey::QXNumber* p, bailey::QXNumber* w) {
+        qxspmv_csr_(&begin, &end, outer, inner, limbs(values), limbs(p), limbs(w));
+    }
+
+    static void spmv_csr(int begin, int end, const int* outer, const int* inner,
+                         const double* values, const bailey::QXNumber* p, bailey::QXNumber* w) {
+        qxspmv_csrd_(&begin, &end, outer, inner, values, limbs(p), limbs(w));
+    }
+};
+#endif // BAILEY_QX_INLINE
+
 /// Template-based BLAS interface for unified high-performance operations
 /// Provides BLAS-like operations for all precision types including DD/DQ/QX
 template<typename T>
 struct BLASTraits {
     
     /// Compute dot product: result = x^T * y
+    /// Deterministic parallel reduction (identical result for any thread count)
     static T dot(const std::vector<T>& x, const std::vector<T>& y) {
-        T result = T(0.0);
-        const size_t n = x.size();
-        
-        // Optimized loop with reduced function call overhead
-        for (size_t i = 0; i < n; ++i) {
-            result = result + x[i] * y[i];
-        }
-        return result;
+        return reduce<T>(x.size(), [&](std::size_t begin, std::size_t end, Accumulator<T>& acc) {
+            if constexpr (VectorKernels<T>::available) {
+                acc.sum = VectorKernels<T>::dot(end - begin, x.data() + begin, y.data() + begin);
+            } else {
+                for (std::size_t i = begin; i < end; ++i) {
+                    acc.add(x[i] * y[i]);
+                }
+            }
+        });
     }
     
     /// AXPY operation: y = alpha * x + y
     static void axpy(const T& alpha, const std::vector<T>& x, std::vector<T>& y) {
         const size_t n = x.size();
         
-        // Cache-friendly sequential access
-        for (size_t i = 0; i < n; ++i) {
-            y[i] = y[i] + alpha * x[i];
+        if constexpr (VectorKernels<T>::available) {
+            VectorKernels<T>::axpy(n, alpha, x.data(), y.data());
+        } else {
+            // Cache-friendly sequential access
+            for (size_t i = 0; i < n; ++i) {
+                y[i] = y[i] + alpha * x[i];
+            }
         }
     }
     
@@ -52,7 +341,9 @@ struct BLASTraits {
     }
 };
 
+#ifdef BAILEY_BLAS_USE_CBLAS
 /// Specialization for double precision - use native BLAS
+/// (opt-in: threaded BLAS reductions are not reproducible across thread counts)
 template<>
 struct BLASTraits<double> {
     
@@ -77,6 +368,7 @@ struct BLASTraits<double> {
         return cblas_dnrm2(static_cast<int>(x.size()), x.data(), 1);
     }
 };
+#endif // BAILEY_BLAS_USE_CBLAS
 
 /// Convenience functions for unified interface
 template<typename T>
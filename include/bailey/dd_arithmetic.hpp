@@ -5,16 +5,26 @@
 #include <cstring>
 #include <cmath>
 #include <Eigen/Sparse>
+#include "dd_inline.hpp"
 
 // DD (Double-Double) precision arithmetic using Bailey's DDFUN library
 extern "C" {
     void ddadd_(const double* a, const double* b, double* c);      // c = a + b
     void ddsub_(const double* a, const double* b, double* c);      // c = a - b
     void ddmul_(const double* a, const double* b, double* c);      // c = a * b
+    void ddmuld_(const double* a, const double* d, double* c);     // c = a * (double)d
     void dddiv_(const double* a, const double* b, double* c);      // c = a / b
     void dddqd_(const double* d, double* a);                       // a = (double)d
     void ddsqrt_(const double* a, double* b);                      // b = sqrt(a)
     void ddtoqd_(const double* a, int* n, char* c, int cl);
+
+    // Array-level routines (one call per vector or row range; CSR arrays 0-based)
+    void ddaxpy_(const int* n, const double* alpha, const double* x, double* y);    // y = y + alpha * x
+    void dddot_(const int* n, const double* x, const double* y, double* s);         // s = sum x(i) * y(i)
+    void ddspmv_csr_(const int* row_begin, const int* row_end, const int* outer, const int* inner,
+                     const double* values, const double* p, double* w);            // w = A * p (DD values)
+    void ddspmv_csrd_(const int* row_begin, const int* row_end, const int* outer, const int* inner,
+                      const double* values, const double* p, double* w);           // w = A * p (double values)
 }
 
 namespace bailey {
@@ -23,10 +33,32 @@ struct DDNumber {
     double dd[2] = {0.0, 0.0};
     
     DDNumber() = default;
+#ifdef BAILEY_DD_INLINE
+    DDNumber(double val) : dd{val, 0.0} {}
+#else
     DDNumber(double val) { dddqd_(&val, dd); }
+#endif
 };
 
 // Basic Arithmetic Operators
+#ifdef BAILEY_DD_INLINE
+// Inline backend: bit-identical to DDFUN, no cross-language call per flop
+inline DDNumber operator+(const DDNumber& a, const DDNumber& b) { 
+    DDNumber r; dd_kernels::add(a.dd, b.dd, r.dd); return r; 
+}
+
+inline DDNumber operator-(const DDNumber& a, const DDNumber& b) { 
+    DDNumber r; dd_kernels::sub(a.dd, b.dd, r.dd); return r; 
+}
+
+inline DDNumber operator*(const DDNumber& a, const DDNumber& b) { 
+    DDNumber r; dd_kernels::mul(a.dd, b.dd, r.dd); return r; 
+}
+
+inline DDNumber operator/(const DDNumber& a, const DDNumber& b) { 
+    DDNumber r; dd_kernels::div(a.dd, b.dd, r.dd); return r; 
+}
+#else
 inline DDNumber operator+(const DDNumber& a, const DDNumber& b) { 
     DDNumber r; ddadd_(a.dd, b.dd, r.dd); return r; 
 }
@@ -42,6 +74,18 @@ inline DDNumber operator*(const DDNumber& a, const DDNumber& b) {
 inline DDNumber operator/(const DDNumber& a, const DDNumber& b) { 
     DDNumber r; dddiv_(a.dd, b.dd, r.dd); return r; 
 }
+#endif
+
+/// a * b for a double b without promoting it to DD first (DDFUN ddmuld)
+///
+/// Same value as a * DDNumber(b); used by SpMV with double-valued matrices.
+inline DDNumber mul_double(const DDNumber& a, double b) {
+#ifdef BAILEY_DD_INLINE
+    DDNumber r; dd_kernels::mul_d(a.dd, b, r.dd); return r;
+#else
+    DDNumber r; ddmuld_(a.dd, &b, r.dd); return r;
+#endif
+}
 
 // Assignment Operators
 inline DDNumber& operator+=(DDNumber& a, const DDNumber& b) { 
@@ -62,7 +106,11 @@ inline DDNumber& operator/=(DDNumber& a, const DDNumber& b) {
 
 // Mathematical Functions
 inline DDNumber sqrt(const DDNumber& a) { 
+#ifdef BAILEY_DD_INLINE
+    DDNumber r; dd_kernels::sqrt(a.dd, r.dd); return r; 
+#else
     DDNumber r; ddsqrt_(a.dd, r.dd); return r; 
+#endif
 }
 
 // Type Conversion (avoid narrowing to double for precision-sensitive output)
@@ -72,15 +120,10 @@ inline std::string to_string(const DDNumber& a, int digits=32) {
     return std::string(s, strnlen(s, sizeof(s)));
 }
 
+// Direct numeric conversion: hi + lo is a single IEEE addition, so it is the
+// correctly rounded double nearest to the DD value (no string formatting)
 inline double to_double(const DDNumber& a) {
-    char s[80] = {0};
-    int d = 32;
-    ddtoqd_(a.dd, &d, s, sizeof(s));
-    try {
-        return std::stod(s);
-    } catch (...) {
-        return a.dd[0];
-    }
+    return a.dd[0] + a.dd[1];
 }
 
 // Stream Output
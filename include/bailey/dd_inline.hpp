@@ -0,0 +1,155 @@
+#pragma once
+
+#include <cmath>
+
+// ==============================================================================
+//  Header-only DD (double-double) kernels
+//
+//  Inlineable C++ transcriptions of the DDFUN routines (ddadd, ddsub, ddmul,
+//  ddmuld, dddiv, ddsqrt) operating on the same double[2] limb layout as dd_real%ddr.
+//  The operation order follows DDFUN step by step so results stay bit-identical
+//  to the Fortran path; the only change is that the exact product error term
+//  is obtained with a single FMA instead of Dekker splitting (both are exact).
+//
+//  The cross term of ddmul, a0*b1 + a1*b0, is written as an explicit FMA so
+//  mul() does not depend on -ffp-contract or the target ISA. It matches DDFUN
+//  built by gfortran for an FMA target with the default -ffp-contract=fast
+//  (e.g. -march=native), which contracts the same term; a DDFUN built without
+//  FMA rounds both products and differs in the last bit. mul_d() likewise
+//  pins its single cross product as a separately rounded value (ddmul with
+//  b1 = 0). div() and sqrt() leave their products to the compiler, so they
+//  match DDFUN when both sides are built with the same -march /
+//  -ffp-contract settings.
+//
+//  Selected by defining BAILEY_DD_INLINE (CMake option ENABLE_DD_INLINE).
+// ==============================================================================
+
+namespace bailey::dd_kernels {
+
+/// Error-free product: p + e == a * b exactly
+inline void two_prod(double a, double b, double& p, double& e) {
+    p = a * b;
+    e = std::fma(a, b, -p);
+}
+
+/// (c0, c1) = (a0, a1) + (b0, b1)  (DDFUN ddadd)
+/// Limb-value form, usable on split hi/lo arrays (see bailey/dd_vector.hpp)
+inline void add(double a0, double a1, double b0, double b1, double& c0, double& c1) {
+    double t1 = a0 + b0;
+    double e = t1 - a0;
+    double t2 = ((b0 - e) + (a0 - (t1 - e))) + a1 + b1;
+    c0 = t1 + t2;
+    c1 = t2 - (c0 - t1);
+}
+
+/// (c0, c1) = (a0, a1) - (b0, b1)  (DDFUN ddsub)
+inline void sub(double a0, double a1, double b0, double b1, double& c0, double& c1) {
+    double t1 = a0 - b0;
+    double e = t1 - a0;
+    double t2 = ((-b0 - e) + (a0 - (t1 - e))) + a1 - b1;
+    c0 = t1 + t2;
+    c1 = t2 - (c0 - t1);
+}
+
+/// (c0, c1) = (a0, a1) * (b0, b1)  (DDFUN ddmul)
+inline void mul(double a0, double a1, double b0, double b1, double& c0, double& c1) {
+    double c11, c21;
+    two_prod(a0, b0, c11, c21);
+    double c2 = std::fma(a0, b1, a1 * b0);
+    double t1 = c11 + c2;
+    double e = t1 - c11;
+    double t2 = ((c2 - e) + (c11 - (t1 - e))) + c21;
+    c0 = t1 + t2;
+    c1 = t2 - (c0 - t1);
+}
+
+/// (c0, c1) = (a0, a1) * b for a plain double b  (DDFUN ddmuld)
+/// Same result as mul() with b1 = 0, one product fewer
+inline void mul_d(double a0, double a1, double b, double& c0, double& c1) {
+    double c11, c21;
+    two_prod(a0, b, c11, c21);
+    // a1 * b rounded on its own, exactly the c2 of mul() with b1 = 0. The FMA
+    // with a zero addend keeps any -ffp-contract setting from fusing it into
+    // the sums below; DDFUN's ddmuld matches when its build leaves this
+    // product unfused as well (see the note at the top)
+    double c2 = std::fma(a1, b, 0.0);
+    double t1 = c11 + c2;
+    double e = t1 - c11;
+    double t2 = ((c2 - e) + (c11 - (t1 - e))) + c21;
+    c0 = t1 + t2;
+    c1 = t2 - (c0 - t1);
+}
+
+/// c = a + b  (DDFUN ddadd)
+inline void add(const double* a, const double* b, double* c) {
+    add(a[0], a[1], b[0], b[1], c[0], c[1]);
+}
+
+/// c = a - b  (DDFUN ddsub)
+inline void sub(const double* a, const double* b, double* c) {
+    sub(a[0], a[1], b[0], b[1], c[0], c[1]);
+}
+
+/// c = a * b  (DDFUN ddmul)
+inline void mul(const double* a, const double* b, double* c) {
+    mul(a[0], a[1], b[0], b[1], c[0], c[1]);
+}
+
+/// c = a * b for a plain double b  (DDFUN ddmuld)
+inline void mul_d(const double* a, double b, double* c) {
+    mul_d(a[0], a[1], b, c[0], c[1]);
+}
+
+/// c = a * b for plain doubles, result in DD  (DDFUN ddmuldd)
+inline void mul_dd(double a, double b, double* c) {
+    double s11, s21;
+    two_prod(a, b, s11, s21);
+    c[0] = s11 + s21;
+    c[1] = s21 - (c[0] - s11);
+}
+
+/// c = a / b  (DDFUN dddiv)
+inline void div(const double* a, const double* b, double* c) {
+    double s1 = a[0] / b[0];
+
+    // (t12, t22) = s1 * b
+    double c11, c21;
+    two_prod(s1, b[0], c11, c21);
+    double c2 = s1 * b[1];
+    double t1 = c11 + c2;
+    double e = t1 - c11;
+    double t2 = ((c2 - e) + (c11 - (t1 - e))) + c21;
+    double t12 = t1 + t2;
+    double t22 = t2 - (t12 - t1);
+
+    // (t11, t21) = a - (t12, t22)
+    double t11 = a[0] - t12;
+    e = t11 - a[0];
+    double t21 = ((-t12 - e) + (a[0] - (t11 - e))) + a[1] - t22;
+
+    double s2 = (t11 + t21) / b[0];
+    c[0] = s1 + s2;
+    c[1] = s2 - (c[0] - s1);
+}
+
+/// b = sqrt(a)  (DDFUN ddsqrt, one Newton-Karp step)
+inline void sqrt(const double* a, double* b) {
+    if (a[0] == 0.0) {
+        b[0] = 0.0;
+        b[1] = 0.0;
+        return;
+    }
+    double t1 = 1.0 / std::sqrt(a[0]);
+    double t2 = a[0] * t1;
+    double s0[2], s1[2];
+    mul_dd(t2, t2, s0);
+    sub(a, s0, s1);
+    double t3 = 0.5 * s1[0] * t1;
+    s0[0] = t2;
+    s0[1] = 0.0;
+    s1[0] = t3;
+    s1[1] = 0.0;
+    add(s0, s1, b);
+}
+
+} // namespace bailey::dd_kernels
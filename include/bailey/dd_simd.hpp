@@ -0,0 +1,427 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdlib>
+#include <cstring>
+#include "dd_inline.hpp"
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#include <immintrin.h>
+#define BAILEY_DD_SIMD_X86 1
+#endif
+
+// ==============================================================================
+//  AVX2 / AVX-512 double-double kernels with runtime dispatch
+//
+//  Hand-vectorized versions of the DD add/mul sequences in dd_inline.hpp,
+//  processing 4 (AVX2) or 8 (AVX-512) DD values per instruction on split
+//  hi/lo limb arrays (bailey::DDVector). The instruction set is chosen once
+//  at runtime via CPUID; set BAILEY_DD_SIMD=scalar|avx2|avx512 to pin it.
+//  Reductions use the same lane layout and fold order on every ISA, scalar
+//  fallback included, and the products use the same explicit FMAs as
+//  dd_kernels::mul/mul_d, so the ISA never changes a result. (Builds with
+//  different -march / -ffp-contract can still differ elsewhere, e.g. in
+//  dd_kernels::div/sqrt, which leave contraction to the compiler.)
+//
+//  Each kernel returns how many leading elements it processed; callers finish
+//  the remainder with the scalar dd_kernels.
+// ==============================================================================
+
+namespace bailey::dd_simd {
+
+enum class Isa { Scalar, AVX2, AVX512 };
+
+/// Number of interleaved accumulators used by dot_lanes (all ISAs)
+inline constexpr std::size_t lanes = 8;
+
+/// Number of interleaved accumulators used by row_dot / row_dot_d (all ISAs)
+inline constexpr std::size_t row_lanes = 4;
+
+inline const char* isa_name(Isa isa) {
+    switch (isa) {
+        case Isa::Scalar: return "scalar";
+        case Isa::AVX2:   return "avx2";
+        case Isa::AVX512: return "avx512";
+    }
+    return "unknown";
+}
+
+/// Instruction set used by the dispatching kernels (detected once)
+inline Isa active_isa() {
+    static const Isa isa = [] {
+        Isa best = Isa::Scalar;
+#ifdef BAILEY_DD_SIMD_X86
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx512f")) {
+            best = Isa::AVX512;
+        } else if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma")) {
+            best = Isa::AVX2;
+        }
+#endif
+        // Optional override, never above what the CPU supports
+        if (const char* env = std::getenv("BAILEY_DD_SIMD")) {
+            if (std::strcmp(env, "scalar") == 0) {
+                best = Isa::Scalar;
+            } else if (std::strcmp(env, "avx2") == 0 && best == Isa::AVX512) {
+                best = Isa::AVX2;
+            }
+        }
+        return best;
+    }();
+    return isa;
+}
+
+#ifdef BAILEY_DD_SIMD_X86
+
+#define BAILEY_TARGET_AVX2 __attribute__((target("avx2,fma"), always_inline)) inline
+#define BAILEY_TARGET_AVX512 __attribute__((target("avx512f"), always_inline)) inline
+
+namespace avx2 {
+
+/// (c0, c1) = (a0, a1) + (b0, b1), 4 lanes (DDFUN ddadd)
+BAILEY_TARGET_AVX2 void add(__m256d a0, __m256d a1, __m256d b0, __m256d b1, __m256d& c0, __m256d& c1) {
+    __m256d t1 = _mm256_add_pd(a0, b0);
+    __m256d e = _mm256_sub_pd(t1, a0);
+    __m256d t2 = _mm256_add_pd(_mm256_sub_pd(b0, e), _mm256_sub_pd(a0, _mm256_sub_pd(t1, e)));
+    t2 = _mm256_add_pd(_mm256_add_pd(t2, a1), b1);
+    c0 = _mm256_add_pd(t1, t2);
+    c1 = _mm256_sub_pd(t2, _mm256_sub_pd(c0, t1));
+}
+
+/// (c0, c1) = (a0, a1) * (b0, b1), 4 lanes (DDFUN ddmul)
+BAILEY_TARGET_AVX2 void mul(__m256d a0, __m256d a1, __m256d b0, __m256d b1, __m256d& c0, __m256d& c1) {
+    __m256d c11 = _mm256_mul_pd(a0, b0);
+    __m256d c21 = _mm256_fmsub_pd(a0, b0, c11);
+    // Same explicit FMA as dd_kernels::mul
+    __m256d c2 = _mm256_fmadd_pd(a0, b1, _mm256_mul_pd(a1, b0));
+    __m256d t1 = _mm256_add_pd(c11, c2);
+    __m256d e = _mm256_sub_pd(t1, c11);
+    __m256d t2 = _mm256_add_pd(_mm256_sub_pd(c2, e), _mm256_sub_pd(c11, _mm256_sub_pd(t1, e)));
+    t2 = _mm256_add_pd(t2, c21);
+    c0 = _mm256_add_pd(t1, t2);
+    c1 = _mm256_sub_pd(t2, _mm256_sub_pd(c0, t1));
+}
+
+/// (c0, c1) = (a0, a1) * b for plain doubles b, 4 lanes (DDFUN ddmuld)
+BAILEY_TARGET_AVX2 void mul_d(__m256d a0, __m256d a1, __m256d b, __m256d& c0, __m256d& c1) {
+    __m256d c11 = _mm256_mul_pd(a0, b);
+    __m256d c21 = _mm256_fmsub_pd(a0, b, c11);
+    // Rounded product, kept out of the following additions as in mul()
+    __m256d c2 = _mm256_fmadd_pd(a1, b, _mm256_setzero_pd());
+    __m256d t1 = _mm256_add_pd(c11, c2);
+    __m256d e = _mm256_sub_pd(t1, c11);
+    __m256d t2 = _mm256_add_pd(_mm256_sub_pd(c2, e), _mm256_sub_pd(c11, _mm256_sub_pd(t1, e)));
+    t2 = _mm256_add_pd(t2, c21);
+    c0 = _mm256_add_pd(t1, t2);
+    c1 = _mm256_sub_pd(t2, _mm256_sub_pd(c0, t1));
+}
+
+__attribute__((target("avx2,fma")))
+inline std::size_t dot_lanes(const double* xh, const double* xl, const double* yh, const double* yl,
+                             std::size_t n, double* sh, double* sl) {
+    __m256d s0h = _mm256_loadu_pd(sh),     s0l = _mm256_loadu_pd(sl);
+    __m256d s1h = _mm256_loadu_pd(sh + 4), s1l = _mm256_loadu_pd(sl + 4);
+    std::size_t i = 0;
+    for (; i + lanes <= n; i += lanes) {
+        __m256d th, tl;
+        mul(_mm256_loadu_pd(xh + i), _mm256_loadu_pd(xl + i),
+            _mm256_loadu_pd(yh + i), _mm256_loadu_pd(yl + i), th, tl);
+        add(s0h, s0l, th, tl, s0h, s0l);
+        mul(_mm256_loadu_pd(xh + i + 4), _mm256_loadu_pd(xl + i + 4),
+            _mm256_loadu_pd(yh + i + 4), _mm256_loadu_pd(yl + i + 4), th, tl);
+        add(s1h, s1l, th, tl, s1h, s1l);
+    }
+    _mm256_storeu_pd(sh, s0h);     _mm256_storeu_pd(sl, s0l);
+    _mm256_storeu_pd(sh + 4, s1h); _mm256_storeu_pd(sl + 4, s1l);
+    return i;
+}
+
+__attribute__((target("avx2,fma")))
+inline std::size_t axpy(double ah, double al, const double* xh, const double* xl,
+                        double* yh, double* yl, std::size_t n) {
+    const __m256d vah = _mm256_set1_pd(ah), val = _mm256_set1_pd(al);
+    std::size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m256d th, tl, rh, rl;
+        mul(vah, val, _mm256_loadu_pd(xh + i), _mm256_loadu_pd(xl + i), th, tl);
+        add(_mm256_loadu_pd(yh + i), _mm256_loadu_pd(yl + i), th, tl, rh, rl);
+        _mm256_storeu_pd(yh + i, rh);
+        _mm256_storeu_pd(yl + i, rl);
+    }
+    return i;
+}
+
+__attribute__((target("avx2,fma")))
+inline std::size_t xpby(const double* rh, const double* rl, double bh, double bl,
+                        double* ph, double* pl, std::size_t n) {
+    const __m256d vbh = _mm256_set1_pd(bh), vbl = _mm256_set1_pd(bl);
+    std::size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m256d th, tl, uh, ul;
+        mul(vbh, vbl, _mm256_loadu_pd(ph + i), _mm256_loadu_pd(pl + i), th, tl);
+        add(_mm256_loadu_pd(rh + i), _mm256_loadu_pd(rl + i), th, tl, uh, ul);
+        _mm256_storeu_pd(ph + i, uh);
+        _mm256_storeu_pd(pl + i, ul);
+    }
+    return i;
+}
+
+/// Sum of values[k] * p[cols[k]] over one CSR row; values are interleaved (hi, lo) pairs
+__attribute__((target("avx2,fma")))
+inline void row_dot(const double* values, const int* cols, std::size_t nnz,
+                    const double* ph, const double* pl, double& sh, double& sl) {
+    __m256d acc_h = _mm256_setzero_pd(), acc_l = _mm256_setzero_pd();
+    std::size_t k = 0;
+    for (; k + 4 <= nnz; k += 4) {
+        // Deinterleave 4 DD matrix values: [h0 l0 h1 l1] [h2 l2 h3 l3] -> [h0..h3] [l0..l3]
+        __m256d v0 = _mm256_loadu_pd(values + 2 * k);
+        __m256d v1 = _mm256_loadu_pd(values + 2 * k + 4);
+        __m256d ah = _mm256_permute4x64_pd(_mm256_unpacklo_pd(v0, v1), 0xD8);
+        __m256d al = _mm256_permute4x64_pd(_mm256_unpackhi_pd(v0, v1), 0xD8);
+        __m128i idx = _mm_loadu_si128(reinterpret_cast<const __m128i*>(cols + k));
+        // Masked form with a zero source avoids GCC's undefined-source warning
+        const __m256d all = _mm256_castsi256_pd(_mm256_set1_epi64x(-1));
+        __m256d xh = _mm256_mask_i32gather_pd(_mm256_setzero_pd(), ph, idx, all, 8);
+        __m256d xl = _mm256_mask_i32gather_pd(_mm256_setzero_pd(), pl, idx, all, 8);
+        __m256d th, tl;
+        mul(ah, al, xh, xl, th, tl);
+        add(acc_h, acc_l, th, tl, acc_h, acc_l);
+    }
+    alignas(32) double lh[4], ll[4];
+    _mm256_store_pd(lh, acc_h);
+    _mm256_store_pd(ll, acc_l);
+    sh = lh[0];
+    sl = ll[0];
+    for (std::size_t l = 1; l < row_lanes; ++l) {
+        dd_kernels::add(sh, sl, lh[l], ll[l], sh, sl);
+    }
+    for (; k < nnz; ++k) {
+        double th, tl;
+        dd_kernels::mul(values[2 * k], values[2 * k + 1], ph[cols[k]], pl[cols[k]], th, tl);
+        dd_kernels::add(sh, sl, th, tl, sh, sl);
+    }
+}
+
+/// Sum of values[k] * p[cols[k]] over one CSR row with double matrix values
+///
+/// Same lane layout as row_dot, so results match a DD matrix holding the same values.
+__attribute__((target("avx2,fma")))
+inline void row_dot_d(const double* values, const int* cols, std::size_t nnz,
+                      const double* ph, const double* pl, double& sh, double& sl) {
+    __m256d acc_h = _mm256_setzero_pd(), acc_l = _mm256_setzero_pd();
+    std::size_t k = 0;
+    for (; k + 4 <= nnz; k += 4) {
+        __m128i idx = _mm_loadu_si128(reinterpret_cast<const __m128i*>(cols + k));
+        const __m256d all = _mm256_castsi256_pd(_mm256_set1_epi64x(-1));
+        __m256d xh = _mm256_mask_i32gather_pd(_mm256_setzero_pd(), ph, idx, all, 8);
+        __m256d xl = _mm256_mask_i32gather_pd(_mm256_setzero_pd(), pl, idx, all, 8);
+        __m256d th, tl;
+        mul_d(xh, xl, _mm256_loadu_pd(values + k), th, tl);
+        add(acc_h, acc_l, th, tl, acc_h, acc_l);
+    }
+    alignas(32) double lh[4], ll[4];
+    _mm256_store_pd(lh, acc_h);
+    _mm256_store_pd(ll, acc_l);
+    sh = lh[0];
+    sl = ll[0];
+    for (std::size_t l = 1; l < row_lanes; ++l) {
+        dd_kernels::add(sh, sl, lh[l], ll[l], sh, sl);
+    }
+    for (; k < nnz; ++k) {
+        double th, tl;
+        dd_kernels::mul_d(ph[cols[k]], pl[cols[k]], values[k], th, tl);
+        dd_kernels::add(sh, sl, th, tl, sh, sl);
+    }
+}
+
+} // namespace avx2
+
+namespace avx512 {
+
+/// (c0, c1) = (a0, a1) + (b0, b1), 8 lanes (DDFUN ddadd)
+BAILEY_TARGET_AVX512 void add(__m512d a0, __m512d a1, __m512d b0, __m512d b1, __m512d& c0, __m512d& c1) {
+    __m512d t1 = _mm512_add_pd(a0, b0);
+    __m512d e = _mm512_sub_pd(t1, a0);
+    __m512d t2 = _mm512_add_pd(_mm512_sub_pd(b0, e), _mm512_sub_pd(a0, _mm512_sub_pd(t1, e)));
+    t2 = _mm512_add_pd(_mm512_add_pd(t2, a1), b1);
+    c0 = _mm512_add_pd(t1, t2);
+    c1 = _mm512_sub_pd(t2, _mm512_sub_pd(c0, t1));
+}
+
+/// (c0, c1) = (a0, a1) * (b0, b1), 8 lanes (DDFUN ddmul)
+BAILEY_TARGET_AVX512 void mul(__m512d a0, __m512d a1, __m512d b0, __m512d b1, __m512d& c0, __m512d& c1) {
+    __m512d c11 = _mm512_mul_pd(a0, b0);
+    __m512d c21 = _mm512_fmsub_pd(a0, b0, c11);
+    // Same explicit FMA as dd_kernels::mul
+    __m512d c2 = _mm512_fmadd_pd(a0, b1, _mm512_mul_pd(a1, b0));
+    __m512d t1 = _mm512_add_pd(c11, c2);
+    __m512d e = _mm512_sub_pd(t1, c11);
+    __m512d t2 = _mm512_add_pd(_mm512_sub_pd(c2, e), _mm512_sub_pd(c11, _mm512_sub_pd(t1, e)));
+    t2 = _mm512_add_pd(t2, c21);
+    c0 = _mm512_add_pd(t1, t2);
+    c1 = _mm512_sub_pd(t2, _mm512_sub_pd(c0, t1));
+}
+
+__attribute__((target("avx512f")))
+inline std::size_t dot_lanes(const double* xh, const double* xl, const double* yh, const double* yl,
+                             std::size_t n, double* sh, double* sl) {
+    __m512d s_h = _mm512_loadu_pd(sh), s_l = _mm512_loadu_pd(sl);
+    std::size_t i = 0;
+    for (; i + lanes <= n; i += lanes) {
+        __m512d th, tl;
+        mul(_mm512_loadu_pd(xh + i), _mm512_loadu_pd(xl + i),
+            _mm512_loadu_pd(yh + i), _mm512_loadu_pd(yl + i), th, tl);
+        add(s_h, s_l, th, tl, s_h, s_l);
+    }
+    _mm512_storeu_pd(sh, s_h);
+    _mm512_storeu_pd(sl, s_l);
+    return i;
+}
+
+__attribute__((target("avx512f")))
+inline std::size_t axpy(double ah, double al, const double* xh, const double* xl,
+                        double* yh, double* yl, std::size_t n) {
+    const __m512d vah = _mm512_set1_pd(ah), val = _mm512_set1_pd(al);
+    std::size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m512d th, tl, rh, rl;
+        mul(vah, val, _mm512_loadu_pd(xh + i), _mm512_loadu_pd(xl + i), th, tl);
+        add(_mm512_loadu_pd(yh + i), _mm512_loadu_pd(yl + i), th, tl, rh, rl);
+        _mm512_storeu_pd(yh + i, rh);
+        _mm512_storeu_pd(yl + i, rl);
+    }
+    return i;
+}
+
+__attribute__((target("avx512f")))
+inline std::size_t xpby(const double* rh, const double* rl, double bh, double bl,
+                        double* ph, double* pl, std::size_t n) {
+    const __m512d vbh = _mm512_set1_pd(bh), vbl = _mm512_set1_pd(bl);
+    std::size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m512d th, tl, uh, ul;
+        mul(vbh, vbl, _mm512_loadu_pd(ph + i), _mm512_loadu_pd(pl + i), th, tl);
+        add(_mm512_loadu_pd(rh + i), _mm512_loadu_pd(rl + i), th, tl, uh, ul);
+        _mm512_storeu_pd(ph + i, uh);
+        _mm512_storeu_pd(pl + i, ul);
+    }
+    return i;
+}
+
+} // namespace avx512
+
+#undef BAILEY_TARGET_AVX2
+#undef BAILEY_TARGET_AVX512
+
+#endif // BAILEY_DD_SIMD_X86
+
+// ---------- Dispatching entry points ------------------------------------------
+
+/// Sum of term(k) for k in [0, nnz) in the lane layout and fold order of
+/// avx2::row_dot (element k -> lane k % row_lanes, lanes folded in order, then
+/// the tail). Scalar reference for row_dot/row_dot_d and for row kernels that
+/// visit a row in pieces, such as symmetric storage.
+/// @param term Callable (k, hi&, lo&) producing the DD term of element k
+template<typename Term>
+inline void row_sum(std::size_t nnz, Term term, double& sh, double& sl) {
+    double lh[row_lanes] = {}, ll[row_lanes] = {};
+    std::size_t k = 0;
+    for (; k + row_lanes <= nnz; k += row_lanes) {
+        for (std::size_t l = 0; l < row_lanes; ++l) {
+            double th, tl;
+            term(k + l, th, tl);
+            dd_kernels::add(lh[l], ll[l], th, tl, lh[l], ll[l]);
+        }
+    }
+    sh = lh[0];
+    sl = ll[0];
+    for (std::size_t l = 1; l < row_lanes; ++l) {
+        dd_kernels::add(sh, sl, lh[l], ll[l], sh, sl);
+    }
+    for (; k < nnz; ++k) {
+        double th, tl;
+        term(k, th, tl);
+        dd_kernels::add(sh, sl, th, tl, sh, sl);
+    }
+}
+
+/// Accumulate x[i]*y[i] into 8 interleaved lane accumulators (element i -> lane i % 8)
+/// @return Number of leading elements processed (a multiple of 8)
+inline std::size_t dot_lanes(const double* xh, const double* xl, const double* yh, const double* yl,
+                             std::size_t n, double* sh, double* sl) {
+#ifdef BAILEY_DD_SIMD_X86
+    switch (active_isa()) {
+        case Isa::AVX512: return avx512::dot_lanes(xh, xl, yh, yl, n, sh, sl);
+        case Isa::AVX2:   return avx2::dot_lanes(xh, xl, yh, yl, n, sh, sl);
+        default: break;
+    }
+#endif
+    (void)xh; (void)xl; (void)yh; (void)yl; (void)n; (void)sh; (void)sl;
+    return 0;
+}
+
+/// y = y + a * x on split limbs
+/// @return Number of leading elements processed
+inline std::size_t axpy(double ah, double al, const double* xh, const double* xl,
+                        double* yh, double* yl, std::size_t n) {
+#ifdef BAILEY_DD_SIMD_X86
+    switch (active_isa()) {
+        case Isa::AVX512: return avx512::axpy(ah, al, xh, xl, yh, yl, n);
+        case Isa::AVX2:   return avx2::axpy(ah, al, xh, xl, yh, yl, n);
+        default: break;
+    }
+#endif
+    (void)ah; (void)al; (void)xh; (void)xl; (void)yh; (void)yl; (void)n;
+    return 0;
+}
+
+/// p = r + b * p on split limbs
+/// @return Number of leading elements processed
+inline std::size_t xpby(const double* rh, const double* rl, double bh, double bl,
+                        double* ph, double* pl, std::size_t n) {
+#ifdef BAILEY_DD_SIMD_X86
+    switch (active_isa()) {
+        case Isa::AVX512: return avx512::xpby(rh, rl, bh, bl, ph, pl, n);
+        case Isa::AVX2:   return avx2::xpby(rh, rl, bh, bl, ph, pl, n);
+        default: break;
+    }
+#endif
+    (void)rh; (void)rl; (void)bh; (void)bl; (void)ph; (void)pl; (void)n;
+    return 0;
+}
+
+/// One CSR row: (sh, sl) = sum_k values[k] * p[cols[k]]
+/// @param values Interleaved (hi, lo) limbs of the row's nnz DD values
+inline void row_dot(const double* values, const int* cols, std::size_t nnz,
+                    const double* ph, const double* pl, double& sh, double& sl) {
+#ifdef BAILEY_DD_SIMD_X86
+    switch (active_isa()) {
+        // CSR rows are short (tens of nonzeros): 8-wide gathers leave long scalar
+        // tails and measured slower than the 4-wide kernel, which every
+        // AVX-512 CPU also supports
+        case Isa::AVX512:
+        case Isa::AVX2:   avx2::row_dot(values, cols, nnz, ph, pl, sh, sl); return;
+        default: break;
+    }
+#endif
+    row_sum(nnz, [&](std::size_t k, double& th, double& tl) {
+        dd_kernels::mul(values[2 * k], values[2 * k + 1], ph[cols[k]], pl[cols[k]], th, tl);
+    }, sh, sl);
+}
+
+/// One CSR row with double matrix values: (sh, sl) = sum_k values[k] * p[cols[k]]
+inline void row_dot_d(const double* values, const int* cols, std::size_t nnz,
+                      const double* ph, const double* pl, double& sh, double& sl) {
+#ifdef BAILEY_DD_SIMD_X86
+    switch (active_isa()) {
+        case Isa::AVX512:
+        case Isa::AVX2:   avx2::row_dot_d(values, cols, nnz, ph, pl, sh, sl); return;
+        default: break;
+    }
+#endif
+    row_sum(nnz, [&](std::size_t k, double& th, double& tl) {
+        dd_kernels::mul_d(ph[cols[k]], pl[cols[k]], values[k], th, tl);
+    }, sh, sl);
+}
+
+} // namespace bailey::dd_simd
@@ -0,0 +1,100 @@
+#pragma once
+
+#include "dd_arithmetic.hpp"
+#include <vector>
+#include <algorithm>
+#include <Eigen/Core>
+
+// ==============================================================================
+//  Structure-of-arrays DD vector
+//
+//  DDVector keeps the hi and lo limbs of its elements in two separate
+//  contiguous double arrays instead of interleaving them (as an
+//  Eigen::Vector<DDNumber> does). Limb-wise kernels can then load hi and lo
+//  lanes into separate SIMD registers. Element access goes through the DDRef
+//  proxy, so precision-generic code written against x[i] keeps working.
+//
+//  Used as PrecisionTraits<DDNumber>::vector_type when BAILEY_DD_SOA is
+//  defined (CMake option ENABLE_DD_SOA).
+// ==============================================================================
+
+namespace bailey {
+
+/// Build a DDNumber from its limbs (no normalization)
+inline DDNumber dd_from_limbs(double hi, double lo) {
+    DDNumber v;
+    v.dd[0] = hi;
+    v.dd[1] = lo;
+    return v;
+}
+
+/// Proxy reference to one element of a DDVector
+class DDRef {
+public:
+    DDRef(double& hi, double& lo) : hi_(hi), lo_(lo) {}
+
+    operator DDNumber() const { return dd_from_limbs(hi_, lo_); }
+
+    DDRef& operator=(const DDNumber& v) {
+        hi_ = v.dd[0];
+        lo_ = v.dd[1];
+        return *this;
+    }
+    DDRef& operator=(const DDRef& other) { return *this = static_cast<DDNumber>(other); }
+
+    DDRef& operator+=(const DDNumber& v) { return *this = static_cast<DDNumber>(*this) + v; }
+    DDRef& operator-=(const DDNumber& v) { return *this = static_cast<DDNumber>(*this) - v; }
+    DDRef& operator*=(const DDNumber& v) { return *this = static_cast<DDNumber>(*this) * v; }
+
+private:
+    double& hi_;
+    double& lo_;
+};
+
+/// Dense DD vector with split hi/lo limb storage
+class DDVector {
+public:
+    using Scalar = DDNumber;
+    using Index = Eigen::Index;
+    using LimbArray = std::vector<double, Eigen::aligned_allocator<double>>;
+
+    DDVector() = default;
+    explicit DDVector(Index n) : hi_(n, 0.0), lo_(n, 0.0) {}
+
+    static DDVector Zero(Index n) { return DDVector(n); }
+    static DDVector Ones(Index n) { return Constant(n, DDNumber(1.0)); }
+    static DDVector Constant(Index n, const DDNumber& value) {
+        DDVector v;
+        v.hi_.assign(n, value.dd[0]);
+        v.lo_.assign(n, value.dd[1]);
+        return v;
+    }
+
+    Index size() const { return static_cast<Index>(hi_.size()); }
+
+    /// Resize (new elements are zero); keeps capacity, so same-size calls never allocate
+    void resize(Index n) {
+        hi_.resize(n, 0.0);
+        lo_.resize(n, 0.0);
+    }
+
+    void setZero() {
+        std::fill(hi_.begin(), hi_.end(), 0.0);
+        std::fill(lo_.begin(), lo_.end(), 0.0);
+    }
+
+    DDNumber operator[](Index i) const { return dd_from_limbs(hi_[i], lo_[i]); }
+    DDRef operator[](Index i) { return DDRef(hi_[i], lo_[i]); }
+    DDNumber coeff(Index i) const { return (*this)[i]; }
+
+    double* hi() { return hi_.data(); }
+    double* lo() { return lo_.data(); }
+    const double* hi() const { return hi_.data(); }
+    const double* lo() const { return lo_.data(); }
+
+private:
+    LimbArray hi_;
+    LimbArray lo_;
+};
+
+} // namespace bailey
@@ -11,10 +11,19 @@ extern "C" {
     void dqadd_(const long double* a, const long double* b, long double* c);      // c = a + b
     void dqsub_(const long double* a, const long double* b, long double* c);      // c = a - b
     void dqmul_(const long double* a, const long double* b, long double* c);      // c = a * b
+    void dqmuld_(const long double* a, const double* d, long double* c);          // c = a * (double)d
     void dqdiv_(const long double* a, const long double* b, long double* c);      // c = a / b
     void dqdqd_(const double* d, long double* a);                                  // a = (double)d
     void dqsqrt_(const long double* a, long double* b);                            // b = sqrt(a)
     void dqtoqd_(const long double* a, int* n, char* c, int cl);
+
+    // Array-level routines (one call per vector or row range; CSR arrays 0-based)
+    void dqaxpy_(const int* n, const long double* alpha, const long double* x, long double* y);  // y = y + alpha * x
+    void dqdot_(const int* n, const long double* x, const long double* y, long double* s);       // s = sum x(i) * y(i)
+    void dqspmv_csr_(const int* row_begin, const int* row_end, const int* outer, const int* inner,
+                     const long double* values, const long double* p, long double* w);        // w = A * p (DQ values)
+    void dqspmv_csrd_(const int* row_begin, const int* row_end, const int* outer, const int* inner,
+                      const double* values, const long double* p, long double* w);            // w = A * p (double values)
 }
 
 namespace bailey {
@@ -43,6 +52,11 @@ inline DQNumber operator/(const DQNumber& a, const DQNumber& b) {
     DQNumber r; dqdiv_(a.dq, b.dq, r.dq); return r; 
 }
 
+/// a * b for a double b without promoting it to DQ first (DQFUN dqmuld)
+inline DQNumber mul_double(const DQNumber& a, double b) {
+    DQNumber r; dqmuld_(a.dq, &b, r.dq); return r;
+}
+
 // Assignment Operators
 inline DQNumber& operator+=(DQNumber& a, const DQNumber& b) { 
     a = a + b; return a; 
@@ -72,15 +86,14 @@ inline std::string to_string(const DQNumber& a, int digits=64) {
     return std::string(s, strnlen(s, sizeof(s)));
 }
 
+// Direct numeric conversion without string formatting.
+// h is the leading limb rounded to double; dq[0] - h is exact in binary128.
+// The tail is rounded to double before the final addition, so the result is
+// within 1 ulp of dq[0] + dq[1] (it can miss the nearest double in tie cases).
 inline double to_double(const DQNumber& a) {
-    char s[128] = {0};
-    int d = 64;
-    dqtoqd_(a.dq, &d, s, sizeof(s));
-    try {
-        return std::stod(s);
-    } catch (...) {
-        return a.dq[0];
-    }
+    double h = static_cast<double>(a.dq[0]);
+    long double tail = (a.dq[0] - static_cast<long double>(h)) + a.dq[1];
+    return h + static_cast<double>(tail);
 }
 
 // Stream Output
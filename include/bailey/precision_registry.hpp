@@ -0,0 +1,61 @@
+#pragma once
+
+#include "precision_traits.hpp"
+#include <array>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+namespace bailey {
+
+/// Compile-time list of precision types, keyed by PrecisionTraits<T>::key()
+///
+/// Turns a runtime key (e.g. "--precision dq") into a template argument:
+/// dispatch() calls a generic callable with std::type_identity<T> for the
+/// matching T, so one list drives validation, help text and dispatch, and
+/// adding a precision means adding it to the list.
+template<typename... Ts>
+struct PrecisionList {
+    static constexpr std::size_t size = sizeof...(Ts);
+
+    /// Keys in list order
+    static constexpr std::array<std::string_view, sizeof...(Ts)> keys{PrecisionTraits<Ts>::key()...};
+
+    static_assert(((!PrecisionTraits<Ts>::key().empty()) && ...), "every listed precision needs a key()");
+
+    /// True if key names a precision in the list
+    static constexpr bool contains(std::string_view key) {
+        for (std::string_view k : keys) {
+            if (k == key) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /// Call f(std::type_identity<T>{}) for the T whose key is @p key
+    /// @return false (f not called) if no precision in the list has that key
+    template<typename F>
+    static bool dispatch(std::string_view key, F&& f) {
+        return ((PrecisionTraits<Ts>::key() == key ? (f(std::type_identity<Ts>{}), true) : false) || ...);
+    }
+
+    /// Keys joined for help and error messages, e.g. "dd, dq, qx, double"
+    /// @param suffix Appended to every key (e.g. "-ir")
+    static std::string join(std::string_view suffix = "", std::string_view separator = ", ") {
+        std::string text;
+        for (std::size_t i = 0; i < keys.size(); ++i) {
+            if (i > 0) {
+                text += separator;
+            }
+            text += keys[i];
+            text += suffix;
+        }
+        return text;
+    }
+};
+
+/// All arithmetic types of the project, in the order they are listed to users
+using AllPrecisions = PrecisionList<DDNumber, DQNumber, QXNumber, double>;
+
+} // namespace bailey
@@ -7,6 +7,7 @@
 #include "qx_arithmetic.hpp"
 #include "dd_arithmetic.hpp"
 #include "dq_arithmetic.hpp"
+#include "dd_vector.hpp"
 
 namespace bailey {
 
@@ -15,13 +16,17 @@ namespace bailey {
 /// Provides unified interface for different arithmetic precision levels,
 /// enabling a single algorithm implementation to work across multiple
 /// precision types (double, DD, DQ, QX).
+/// Sparse matrices are stored row-major (CSR) so that SpMV kernels can
+/// traverse rows and fuse reductions into the same sweep.
 template<typename T>
 struct PrecisionTraits {
     using scalar_type = T;
-    using matrix_type = Eigen::SparseMatrix<T>;
+    using matrix_type = Eigen::SparseMatrix<T, Eigen::RowMajor>;
+    using block_type = Eigen::Matrix<T, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>;  // n x k block of vectors (multi-RHS)
     using vector_type = Eigen::Vector<T, Eigen::Dynamic>;
     
     static constexpr const char* name() { return "Unknown"; }
+    static constexpr std::string_view key() { return ""; }  // command-line name (--precision)
     static constexpr int decimal_digits() { return 0; }
 };
 
@@ -32,10 +37,16 @@ struct PrecisionTraits {
 template<>
 struct PrecisionTraits<bailey::DDNumber> {
     using scalar_type = bailey::DDNumber;
-    using matrix_type = Eigen::SparseMatrix<bailey::DDNumber>;
+    using matrix_type = Eigen::SparseMatrix<bailey::DDNumber, Eigen::RowMajor>;
+    using block_type = Eigen::Matrix<bailey::DDNumber, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>;
+#ifdef BAILEY_DD_SOA
+    using vector_type = bailey::DDVector;  // split hi/lo limbs (dd_vector.hpp)
+#else
     using vector_type = Eigen::Vector<bailey::DDNumber, Eigen::Dynamic>;
+#endif
     
     static constexpr const char* name() { return "DD"; }
+    static constexpr std::string_view key() { return "dd"; }
     static constexpr int decimal_digits() { return 30; }
 };
 
@@ -44,10 +55,12 @@ struct PrecisionTraits<bailey::DDNumber> {
 template<>
 struct PrecisionTraits<bailey::DQNumber> {
     using scalar_type = bailey::DQNumber;
-    using matrix_type = Eigen::SparseMatrix<bailey::DQNumber>;
+    using matrix_type = Eigen::SparseMatrix<bailey::DQNumber, Eigen::RowMajor>;
+    using block_type = Eigen::Matrix<bailey::DQNumber, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>;
     using vector_type = Eigen::Vector<bailey::DQNumber, Eigen::Dynamic>;
     
     static constexpr const char* name() { return "DQ"; }
+    static constexpr std::string_view key() { return "dq"; }
     static constexpr int decimal_digits() { return 64; }
 };
 
@@ -56,10 +69,12 @@ struct PrecisionTraits<bailey::DQNumber> {
 template<>
 struct PrecisionTraits<bailey::QXNumber> {
     using scalar_type = bailey::QXNumber;
-    using matrix_type = Eigen::SparseMatrix<bailey::QXNumber>;
+    using matrix_type = Eigen::SparseMatrix<bailey::QXNumber, Eigen::RowMajor>;
+    using block_type = Eigen::Matrix<bailey::QXNumber, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>;
     using vector_type = Eigen::Vector<bailey::QXNumber, Eigen::Dynamic>;
     
     static constexpr const char* name() { return "QX"; }
+    static constexpr std::string_view key() { return "qx"; }
     static constexpr int decimal_digits() { return 33; }
 };
 
@@ -76,10 +91,12 @@ using QXTraits = PrecisionTraits<bailey::QXNumber>;
 template<>
 struct bailey::PrecisionTraits<double> {
     using scalar_type = double;
-    using matrix_type = Eigen::SparseMatrix<double>;
+    using matrix_type = Eigen::SparseMatrix<double, Eigen::RowMajor>;
+    using block_type = Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>;
     using vector_type = Eigen::Vector<double, Eigen::Dynamic>;
     
     static constexpr const char* name() { return "Double"; }
+    static constexpr std::string_view key() { return "double"; }
     static constexpr int decimal_digits() { return 15; }
 };
 
@@ -90,4 +107,9 @@ using DoubleTraits = PrecisionTraits<double>;
 // Identity function for double type - fixes missing to_double(double) specialization
 inline double to_double(const double& a) {
     return a;
-}
\ No newline at end of file
+}
+
+// Counterpart of bailey::mul_double for double (matrix values promoted on the fly)
+inline double mul_double(double a, double b) {
+    return a * b;
+}
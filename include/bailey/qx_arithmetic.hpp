@@ -8,6 +8,7 @@
 #include <algorithm>
 #include <Eigen/Sparse>
 #include <Eigen/Core>
+#include "qx_inline.hpp"
 
 // ==============================================================================
 //  Bailey QX高精度算術ライブラリとの連携のためのQXNumber型定義
@@ -22,6 +23,14 @@ extern "C" {
     void qxdqd_(const double* d, long double* a);                                 // a = (double)d
     void qxsqrt_(const long double* a, long double* b);                           // b = sqrt(a)
     void qxtoqd_(const long double* a, int* n, char* c, int cl);
+
+    // Array-level routines (one call per vector or row range; CSR arrays 0-based)
+    void qxaxpy_(const int* n, const long double* alpha, const long double* x, long double* y);  // y = y + alpha * x
+    void qxdot_(const int* n, const long double* x, const long double* y, long double* s);       // s = sum x(i) * y(i)
+    void qxspmv_csr_(const int* row_begin, const int* row_end, const int* outer, const int* inner,
+                     const long double* values, const long double* p, long double* w);        // w = A * p (QX values)
+    void qxspmv_csrd_(const int* row_begin, const int* row_end, const int* outer, const int* inner,
+                      const double* values, const long double* p, long double* w);            // w = A * p (double values)
 }
 
 namespace bailey {
@@ -36,14 +45,9 @@ struct QXNumber {
     QXNumber(long double val) : qx(val) {}
     QXNumber(int val) : qx(static_cast<long double>(val)) {}     // Add int constructor for Eigen
     
-    // Copy constructor and assignment
-    QXNumber(const QXNumber& other) : qx(other.qx) {}
-    QXNumber& operator=(const QXNumber& other) {
-        if (this != &other) {
-            qx = other.qx;
-        }
-        return *this;
-    }
+    // Copy constructor and assignment (trivial, so QX arrays copy like plain long double)
+    QXNumber(const QXNumber& other) = default;
+    QXNumber& operator=(const QXNumber& other) = default;
     
     // Direct access to long double for Bailey Fortran interface
     const long double* get_qx_ptr() const {
@@ -56,6 +60,27 @@ struct QXNumber {
 };
 
 // --- Basic Arithmetic Operators ---
+#ifdef BAILEY_QX_INLINE
+static_assert(qx_kernels::long_double_is_binary128,
+              "BAILEY_QX_INLINE requires long double to be IEEE binary128 (see check_ldbl)");
+
+// Inline backend: bit-identical to QXFUN, no cross-language call per flop
+inline QXNumber operator+(const QXNumber& a, const QXNumber& b) { 
+    return QXNumber(qx_kernels::add(a.qx, b.qx)); 
+}
+
+inline QXNumber operator-(const QXNumber& a, const QXNumber& b) { 
+    return QXNumber(qx_kernels::sub(a.qx, b.qx)); 
+}
+
+inline QXNumber operator*(const QXNumber& a, const QXNumber& b) { 
+    return QXNumber(qx_kernels::mul(a.qx, b.qx)); 
+}
+
+inline QXNumber operator/(const QXNumber& a, const QXNumber& b) { 
+    return QXNumber(qx_kernels::div(a.qx, b.qx)); 
+}
+#else
 inline QXNumber operator+(const QXNumber& a, const QXNumber& b) { 
     QXNumber result;
     qxadd_(a.get_qx_ptr(), b.get_qx_ptr(), result.get_qx_ptr());
@@ -79,6 +104,12 @@ inline QXNumber operator/(const QXNumber& a, const QXNumber& b) {
     qxdiv_(a.get_qx_ptr(), b.get_qx_ptr(), result.get_qx_ptr());
     return result; 
 }
+#endif
+
+/// a * b for a double b (QX has a single limb, so this is an ordinary QX multiply)
+inline QXNumber mul_double(const QXNumber& a, double b) {
+    return a * QXNumber(b);
+}
 
 // --- Assignment Operators ---
 inline QXNumber& operator+=(QXNumber& a, const QXNumber& b) { 
@@ -137,9 +168,13 @@ inline bool operator>=(const QXNumber& a, const QXNumber& b) {
 
 // --- Mathematical Functions ---
 inline QXNumber sqrt(const QXNumber& a) { 
+#ifdef BAILEY_QX_INLINE
+    return QXNumber(qx_kernels::sqrt(a.qx));
+#else
     QXNumber result;
     qxsqrt_(a.get_qx_ptr(), result.get_qx_ptr());
     return result; 
+#endif
 }
 
 inline QXNumber abs(const QXNumber& a) {
@@ -153,15 +188,9 @@ inline std::string to_string(const QXNumber& a, int digits=33) {
     return std::string(s, strnlen(s, sizeof(s)));
 }
 
+// Direct numeric conversion (single correctly rounded narrowing, no string formatting)
 inline double to_double(const QXNumber& a) {
-    char s[128] = {0};
-    int d = 33;
-    qxtoqd_(&a.qx, &d, s, sizeof(s));
-    try {
-        return std::stod(s);
-    } catch (...) {
-        return static_cast<double>(a.qx);
-    }
+    return static_cast<double>(a.qx);
 }
 
 // --- Stream Output ---
@@ -0,0 +1,40 @@
+#pragma once
+
+#include <cmath>
+#include <cfloat>
+
+// ==============================================================================
+//  Header-only QX (binary128) kernels
+//
+//  QXFUN works on a single real(qxknd) = IEEE binary128 value, and the
+//  wrappers (qxadd_, qxmul_, ...) only evaluate `c = a op b`. This project
+//  requires long double to be binary128 (see check_ldbl), so the same
+//  correctly rounded operations are available directly in C++ through the
+//  compiler's long double (soft-float) arithmetic. Results are bit-identical
+//  to the Fortran path, and the optimizer can inline and schedule them in the
+//  SpMV and dot loops instead of stopping at a cross-language call per flop.
+//
+//  Selected by defining BAILEY_QX_INLINE (CMake option ENABLE_QX_INLINE).
+// ==============================================================================
+
+namespace bailey::qx_kernels {
+
+/// True if long double is IEEE binary128, the format of QXFUN's real(qxknd)
+inline constexpr bool long_double_is_binary128 = LDBL_MANT_DIG == 113 && LDBL_MAX_EXP == 16384;
+
+/// a + b  (QXFUN qxadd)
+inline long double add(long double a, long double b) { return a + b; }
+
+/// a - b  (QXFUN qxsub)
+inline long double sub(long double a, long double b) { return a - b; }
+
+/// a * b  (QXFUN qxmul)
+inline long double mul(long double a, long double b) { return a * b; }
+
+/// a / b  (QXFUN qxdiv)
+inline long double div(long double a, long double b) { return a / b; }
+
+/// Correctly rounded square root  (QXFUN qxsqrt)
+inline long double sqrt(long double a) { return std::sqrt(a); }
+
+} // namespace bailey::qx_kernels
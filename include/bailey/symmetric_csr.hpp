@@ -0,0 +1,182 @@
+#pragma once
+
+#include <vector>
+#include <stdexcept>
+#include <cstddef>
+#include <Eigen/Core>
+
+// ==============================================================================
+//  Symmetric CSR matrix (upper triangle stored)
+//
+//  Values are stored once, for the upper triangle including the diagonal, in
+//  row-major CSR order. To keep SpMV row-parallel without atomics or
+//  per-thread output copies, the strictly lower triangle is described by a
+//  transposed index (column, position of the mirrored value) that references
+//  the upper-triangle value array instead of duplicating it. A row product
+//  visits columns in ascending order exactly like a full CSR row, so results
+//  are bitwise identical to full storage (the DD structure-of-arrays kernels
+//  also sum symmetric rows in the lanes of the full-storage SIMD rows).
+//
+//  Memory per off-diagonal pair: one value + 3 ints, instead of two values +
+//  two ints with full CSR: 28 vs 40 bytes in DD (~30% less), 44 vs 72 bytes
+//  in DQ (~40% less).
+// ==============================================================================
+
+namespace bailey {
+
+template<typename Value>
+class SymmetricCsrMatrix {
+public:
+    using Scalar = Value;
+    using Index = Eigen::Index;
+
+    SymmetricCsrMatrix() = default;
+
+    /// Build from a full (both triangles) CSR matrix with sorted rows
+    ///
+    /// @param convert Callable mapping a source value to Value
+    /// @throws std::runtime_error if the matrix is not square or not symmetric
+    template<typename Source, typename Convert>
+    static SymmetricCsrMatrix fromFullCsr(int nrows, int ncols, const int* row_ptr, const int* col_idx,
+                                          const Source* values, Convert convert) {
+        if (nrows != ncols) {
+            throw std::runtime_error("Symmetric storage requires a square matrix");
+        }
+
+        SymmetricCsrMatrix m;
+        m.n_ = nrows;
+
+        // Upper triangle (col >= row), rows already sorted by column
+        m.upper_outer_.assign(nrows + 1, 0);
+        for (int i = 0; i < nrows; ++i) {
+            int count = 0;
+            for (int k = row_ptr[i]; k < row_ptr[i + 1]; ++k) {
+                count += col_idx[k] >= i;
+            }
+            m.upper_outer_[i + 1] = m.upper_outer_[i] + count;
+        }
+        const int upper_nnz = m.upper_outer_[nrows];
+        m.upper_inner_.resize(upper_nnz);
+        m.values_.resize(upper_nnz);
+
+        // Transposed index of the strictly upper part = lower triangle rows
+        m.lower_outer_.assign(nrows + 1, 0);
+        for (int i = 0; i < nrows; ++i) {
+            int pos = m.upper_outer_[i];
+            for (int k = row_ptr[i]; k < row_ptr[i + 1]; ++k) {
+                if (col_idx[k] >= i) {
+                    m.upper_inner_[pos] = col_idx[k];
+                    m.values_[pos] = convert(values[k]);
+                    ++pos;
+                    if (col_idx[k] > i) {
+                        ++m.lower_outer_[col_idx[k] + 1];
+                    }
+                }
+            }
+        }
+        for (int i = 0; i < nrows; ++i) {
+            m.lower_outer_[i + 1] += m.lower_outer_[i];
+        }
+        m.lower_inner_.resize(m.lower_outer_[nrows]);
+        m.lower_pos_.resize(m.lower_outer_[nrows]);
+        std::vector<int> next(m.lower_outer_.begin(), m.lower_outer_.end() - 1);
+        for (int i = 0; i < nrows; ++i) {
+            for (int k = m.upper_outer_[i]; k < m.upper_outer_[i + 1]; ++k) {
+                const int j = m.upper_inner_[k];
+                if (j > i) {
+                    const int slot = next[j]++;
+                    m.lower_inner_[slot] = i;
+                    m.lower_pos_[slot] = k;
+                }
+            }
+        }
+
+        // Symmetry check: the source lower triangle must mirror the upper one
+        for (int i = 0; i < nrows; ++i) {
+            int slot = m.lower_outer_[i];
+            for (int k = row_ptr[i]; k < row_ptr[i + 1] && col_idx[k] < i; ++k, ++slot) {
+                if (slot >= m.lower_outer_[i + 1] || m.lower_inner_[slot] != col_idx[k] ||
+                    !(values[k] == values[mirror_source(row_ptr, col_idx, col_idx[k], i)])) {
+                    throw std::runtime_error("Matrix is not symmetric; use full storage");
+                }
+            }
+            if (slot != m.lower_outer_[i + 1]) {
+                throw std::runtime_error("Matrix is not symmetric; use full storage");
+            }
+        }
+        return m;
+    }
+
+    Index rows() const { return n_; }
+    Index cols() const { return n_; }
+
+    /// Nonzeros of the full matrix represented
+    Index nonZeros() const { return 2 * static_cast<Index>(values_.size()) - diagonalCount(); }
+
+    /// Values actually stored (upper triangle including diagonal)
+    Index storedNonZeros() const { return static_cast<Index>(values_.size()); }
+
+    /// Bytes used by values and index arrays
+    std::size_t memoryBytes() const {
+        return values_.size() * sizeof(Value)
+             + (upper_outer_.size() + upper_inner_.size()
+                + lower_outer_.size() + lower_inner_.size() + lower_pos_.size()) * sizeof(int);
+    }
+
+    /// Convert the stored values to another scalar type (same structure)
+    template<typename To, typename Convert>
+    SymmetricCsrMatrix<To> cast(Convert convert) const {
+        SymmetricCsrMatrix<To> m;
+        m.n_ = n_;
+        m.upper_outer_ = upper_outer_;
+        m.upper_inner_ = upper_inner_;
+        m.lower_outer_ = lower_outer_;
+        m.lower_inner_ = lower_inner_;
+        m.lower_pos_ = lower_pos_;
+        m.values_.resize(values_.size());
+        for (std::size_t k = 0; k < values_.size(); ++k) {
+            m.values_[k] = convert(values_[k]);
+        }
+        return m;
+    }
+
+    // Raw CSR access for kernels
+    const int* upperOuter() const { return upper_outer_.data(); }
+    const int* upperInner() const { return upper_inner_.data(); }
+    const Value* values() const { return values_.data(); }
+    const int* lowerOuter() const { return lower_outer_.data(); }
+    const int* lowerInner() const { return lower_inner_.data(); }
+    const int* lowerPos() const { return lower_pos_.data(); }
+
+private:
+    template<typename> friend class SymmetricCsrMatrix;
+
+    /// Position of (row, col) in the source CSR (entry known to exist)
+    static int mirror_source(const int* row_ptr, const int* col_idx, int row, int col) {
+        int lo = row_ptr[row];
+        int hi = row_ptr[row + 1];
+        while (lo < hi) {
+            int mid = (lo + hi) / 2;
+            if (col_idx[mid] < col) lo = mid + 1; else hi = mid;
+        }
+        return lo;
+    }
+
+    Index diagonalCount() const {
+        Index count = 0;
+        for (int i = 0; i < n_; ++i) {
+            count += upper_outer_[i] < upper_outer_[i + 1] && upper_inner_[upper_outer_[i]] == i;
+        }
+        return count;
+    }
+
+    int n_{0};
+    std::vector<int> upper_outer_;
+    std::vector<int> upper_inner_;
+    std::vector<Value> values_;
+    std::vector<int> lower_outer_;
+    std::vector<int> lower_inner_;   ///< Column j < i of each lower-triangle entry
+    std::vector<int> lower_pos_;     ///< Index of the mirrored value a(j, i) in values_
+};
+
+} // namespace bailey
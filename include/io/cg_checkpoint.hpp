@@ -0,0 +1,451 @@
+#pragma once
+
+#include "algorithms/conjugate_gradient.hpp"
+#include "io/csr_cache.hpp"
+#include "io/history_stream.hpp"
+#include <cstdint>
+#include <cstring>
+#include <cstdio>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <fstream>
+#include <mutex>
+#include <thread>
+#include <condition_variable>
+#include <stdexcept>
+#include <algorithm>
+#include <utility>
+#include <type_traits>
+#include <unistd.h>
+
+// ==============================================================================
+//  CG checkpoint files (algorithms::CGState)
+//
+//  Layout (native endianness, little-endian on all supported targets):
+//    CgCheckpointHeader (136 bytes)
+//    rho_old         T
+//    x, r, p         T[n] each
+//    hist_relres_2   double[residual_count]
+//    hist_relerr_2   double[error_count]
+//    hist_relerr_A   double[error_count]
+//    hist_relerr_iter int32[error_count]
+//
+//  T values are stored as their raw limbs (double[2] for DD, long double[2]
+//  for DQ, the binary128 long double for QX), so a resumed solve starts from
+//  exactly the numbers the interrupted one held. The header records the
+//  precision key and limb size, and a checksum of the right-hand side, so a
+//  checkpoint is only accepted for the problem it was written for. Histories
+//  are empty when they were streamed; history_entries is the stream offset.
+// ==============================================================================
+
+namespace io {
+
+struct CgCheckpointHeader {
+    char magic[8];                    ///< "BLYCGCP1"
+    char precision[8];                ///< PrecisionTraits<T>::key(), zero padded
+    std::int64_t value_bytes;         ///< sizeof(T)
+    std::int64_t n;
+    std::int64_t iteration;
+    std::int64_t history_entries;     ///< CGResult::history_entries (history stream offset)
+    std::int64_t residual_count;      ///< Stored hist_relres_2 entries
+    std::int64_t error_count;         ///< Stored hist_relerr_* entries
+    std::uint64_t rhs_checksum;       ///< checkpointRhsChecksum(b)
+    std::uint64_t checksum;           ///< csrChecksum over everything after the header
+    double relres;
+    double initial_residual_norm;
+    double elapsed_time;
+    double final_relerr_2;
+    double final_relerr_A;
+    std::int32_t diagnostics_mode;    ///< algorithms::DiagnosticsMode
+    std::int32_t diagnostics_interval;
+    std::int32_t streamed;
+    std::int32_t reserved;
+};
+static_assert(sizeof(CgCheckpointHeader) == 136, "checkpoint header layout");
+
+inline constexpr char cg_checkpoint_magic[8] = {'B', 'L', 'Y', 'C', 'G', 'C', 'P', '1'};
+
+namespace detail {
+
+template<typename T>
+void appendValues(std::vector<char>& bytes, const T* values, std::size_t count) {
+    static_assert(std::is_trivially_copyable_v<T>, "checkpoint values are stored as raw limbs");
+    const char* begin = reinterpret_cast<const char*>(values);
+    bytes.insert(bytes.end(), begin, begin + sizeof(T) * count);
+}
+
+/// Append the limbs of every element (element-wise, so split-limb vectors work too)
+template<typename T, typename VectorType>
+void appendVector(std::vector<char>& bytes, const VectorType& v) {
+    for (Eigen::Index i = 0; i < v.size(); ++i) {
+        T value = v[i];
+        appendValues(bytes, &value, 1);
+    }
+}
+
+/// Sequential reader over a checkpoint payload
+class PayloadReader {
+public:
+    PayloadReader(const std::vector<char>& bytes, const std::string& path) : bytes_(bytes), path_(path) {}
+
+    template<typename T>
+    void read(T* values, std::size_t count) {
+        static_assert(std::is_trivially_copyable_v<T>, "checkpoint values are stored as raw limbs");
+        const std::size_t size = sizeof(T) * count;
+        if (offset_ + size > bytes_.size()) {
+            throw std::runtime_error("Truncated checkpoint: " + path_);
+        }
+        std::memcpy(static_cast<void*>(values), bytes_.data() + offset_, size);
+        offset_ += size;
+    }
+
+    template<typename T, typename VectorType>
+    void readVector(VectorType& v, Eigen::Index n) {
+        v.resize(n);
+        for (Eigen::Index i = 0; i < n; ++i) {
+            T value;
+            read(&value, 1);
+            v[i] = value;
+        }
+    }
+
+    bool done() const { return offset_ == bytes_.size(); }
+
+private:
+    const std::vector<char>& bytes_;
+    const std::string& path_;
+    std::size_t offset_{0};
+};
+
+} // namespace detail
+
+/// Checksum identifying the right-hand side a checkpoint belongs to
+template<typename T>
+std::uint64_t checkpointRhsChecksum(const typename bailey::PrecisionTraits<T>::vector_type& b) {
+    std::vector<char> bytes;
+    bytes.reserve(sizeof(T) * b.size());
+    detail::appendVector<T>(bytes, b);
+    return csrChecksum(bytes.data(), bytes.size());
+}
+
+/// Write a checkpoint file
+///
+/// Written under a temporary name, synced to disk and renamed into place, so
+/// an interruption during the write leaves the previous checkpoint intact.
+/// @throws std::runtime_error if the file cannot be written
+template<typename T>
+void writeCheckpoint(const std::string& path, const algorithms::CGState<T>& state, std::uint64_t rhs_checksum) {
+    using Traits = bailey::PrecisionTraits<T>;
+    const auto& progress = state.progress;
+
+    std::vector<char> payload;
+    payload.reserve(sizeof(T) * (3 * state.x.size() + 1) +
+                    sizeof(double) * (progress.hist_relres_2.size() + 2 * progress.hist_relerr_2.size()) +
+                    sizeof(std::int32_t) * progress.hist_relerr_iter.size());
+    detail::appendValues(payload, &state.rho_old, 1);
+    detail::appendVector<T>(payload, state.x);
+    detail::appendVector<T>(payload, state.r);
+    detail::appendVector<T>(payload, state.p);
+    detail::appendValues(payload, progress.hist_relres_2.data(), progress.hist_relres_2.size());
+    detail::appendValues(payload, progress.hist_relerr_2.data(), progress.hist_relerr_2.size());
+    detail::appendValues(payload, progress.hist_relerr_A.data(), progress.hist_relerr_A.size());
+    for (int iter : progress.hist_relerr_iter) {
+        std::int32_t value = iter;
+        detail::appendValues(payload, &value, 1);
+    }
+
+    CgCheckpointHeader header{};
+    std::memcpy(header.magic, cg_checkpoint_magic, sizeof(header.magic));
+    std::string_view key = Traits::key();
+    std::memcpy(header.precision, key.data(), std::min(key.size(), sizeof(header.precision)));
+    header.value_bytes = sizeof(T);
+    header.n = state.x.size();
+    header.iteration = state.iteration;
+    header.history_entries = static_cast<std::int64_t>(progress.history_entries);
+    header.residual_count = static_cast<std::int64_t>(progress.hist_relres_2.size());
+    header.error_count = static_cast<std::int64_t>(progress.hist_relerr_2.size());
+    header.rhs_checksum = rhs_checksum;
+    header.checksum = csrChecksum(payload.data(), payload.size());
+    header.relres = state.relres;
+    header.initial_residual_norm = progress.initial_residual_norm;
+    header.elapsed_time = state.elapsed_time;
+    header.final_relerr_2 = progress.final_relerr_2;
+    header.final_relerr_A = progress.final_relerr_A;
+    header.diagnostics_mode = static_cast<std::int32_t>(progress.diagnostics.mode);
+    header.diagnostics_interval = progress.diagnostics.interval;
+    header.streamed = state.streamed ? 1 : 0;
+
+    const std::string tmp_path = path + ".tmp" + std::to_string(::getpid());
+    std::FILE* out = std::fopen(tmp_path.c_str(), "wb");
+    if (!out) {
+        throw std::runtime_error("Cannot write checkpoint: " + tmp_path);
+    }
+    bool ok = std::fwrite(&header, sizeof(header), 1, out) == 1 &&
+              std::fwrite(payload.data(), 1, payload.size(), out) == payload.size() &&
+              std::fflush(out) == 0 && ::fsync(fileno(out)) == 0;
+    ok = std::fclose(out) == 0 && ok;
+    if (!ok) {
+        std::remove(tmp_path.c_str());
+        throw std::runtime_error("Cannot write checkpoint: " + tmp_path);
+    }
+    if (std::rename(tmp_path.c_str(), path.c_str()) != 0) {
+        std::remove(tmp_path.c_str());
+        throw std::runtime_error("Cannot write checkpoint: " + path);
+    }
+}
+
+/// Read a checkpoint written for precision T and right-hand side b
+/// @throws std::runtime_error if the file is missing, corrupt, or belongs to another problem
+template<typename T>
+algorithms::CGState<T> readCheckpoint(const std::string& path,
+                                      const typename bailey::PrecisionTraits<T>::vector_type& b) {
+    using Traits = bailey::PrecisionTraits<T>;
+
+    std::ifstream in(path, std::ios::binary | std::ios::ate);
+    if (!in) {
+        throw std::runtime_error("Cannot open checkpoint: " + path);
+    }
+    const std::streamoff size = in.tellg();
+    in.seekg(0);
+    CgCheckpointHeader header;
+    if (size < static_cast<std::streamoff>(sizeof(header)) ||
+        !in.read(reinterpret_cast<char*>(&header), sizeof(header)) ||
+        std::memcmp(header.magic, cg_checkpoint_magic, sizeof(header.magic)) != 0) {
+        throw std::runtime_error("Not a CG checkpoint: " + path);
+    }
+    std::vector<char> payload(static_cast<std::size_t>(size) - sizeof(header));
+    if (!in.read(payload.data(), static_cast<std::streamsize>(payload.size())) ||
+        csrChecksum(payload.data(), payload.size()) != header.checksum) {
+        throw std::runtime_error("Corrupt checkpoint (checksum mismatch): " + path);
+    }
+
+    const std::string_view key(header.precision, strnlen(header.precision, sizeof(header.precision)));
+    if (key != Traits::key() || header.value_bytes != static_cast<std::int64_t>(sizeof(T))) {
+        throw std::runtime_error("Checkpoint " + path + " was written in precision " + std::string(key) +
+                                 ", not " + std::string(Traits::key()));
+    }
+    if (header.n != b.size() || header.rhs_checksum != checkpointRhsChecksum<T>(b)) {
+        throw std::runtime_error("Checkpoint " + path + " was written for a different matrix or right-hand side");
+    }
+    if (header.iteration < 0 || header.residual_count < 0 || header.error_count < 0 || header.history_entries < 0) {
+        throw std::runtime_error("Corrupt checkpoint: " + path);
+    }
+
+    algorithms::CGState<T> state;
+    state.iteration = static_cast<int>(header.iteration);
+    state.relres = header.relres;
+    state.elapsed_time = header.elapsed_time;
+    state.streamed = header.streamed != 0;
+
+    auto& progress = state.progress;
+    progress.diagnostics.mode = static_cast<algorithms::DiagnosticsMode>(header.diagnostics_mode);
+    progress.diagnostics.interval = header.diagnostics_interval;
+    progress.initial_residual_norm = header.initial_residual_norm;
+    progress.final_relerr_2 = header.final_relerr_2;
+    progress.final_relerr_A = header.final_relerr_A;
+    progress.history_entries = static_cast<std::size_t>(header.history_entries);
+
+    detail::PayloadReader reader(payload, path);
+    reader.read(&state.rho_old, 1);
+    reader.readVector<T>(state.x, header.n);
+    reader.readVector<T>(state.r, header.n);
+    reader.readVector<T>(state.p, header.n);
+    progress.hist_relres_2.resize(header.residual_count);
+    progress.hist_relerr_2.resize(header.error_count);
+    progress.hist_relerr_A.resize(header.error_count);
+    progress.hist_relerr_iter.resize(header.error_count);
+    reader.read(progress.hist_relres_2.data(), progress.hist_relres_2.size());
+    reader.read(progress.hist_relerr_2.data(), progress.hist_relerr_2.size());
+    reader.read(progress.hist_relerr_A.data(), progress.hist_relerr_A.size());
+    for (int& iter : progress.hist_relerr_iter) {
+        std::int32_t value;
+        reader.read(&value, 1);
+        iter = value;
+    }
+    if (!reader.done()) {
+        throw std::runtime_error("Corrupt checkpoint (trailing data): " + path);
+    }
+    return state;
+}
+
+/// Checkpoint sink that writes CG states from a background thread
+///
+/// save() only copies the state into a staging buffer and returns; the
+/// writer thread serializes and writes it. If a new state arrives while an
+/// older one is still staged, the newer one replaces it, so iterations never
+/// wait for the disk. Of the in-memory histories, save() copies only the
+/// entries recorded since the previous save; the writer thread keeps the
+/// full histories, so a checkpoint costs O(n) on the solver thread however
+/// long the solve has run. One writer serves one solve.
+template<typename T>
+class CheckpointWriter : public algorithms::CheckpointSink<T> {
+public:
+    using VectorType = typename bailey::PrecisionTraits<T>::vector_type;
+
+    /// @param path Checkpoint file (replaced atomically on every write)
+    /// @param b Right-hand side of the solve (identifies the problem on resume)
+    /// @param history Stream receiving the solve's histories, if any: each checkpoint
+    ///                is committed only after the stream is synced up to its offset
+    CheckpointWriter(const std::string& path, const VectorType& b, HistoryStream* history = nullptr)
+        : path_(path), rhs_checksum_(checkpointRhsChecksum<T>(b)), history_(history) {
+        writer_ = std::thread([this] { run(); });
+    }
+
+    CheckpointWriter(const CheckpointWriter&) = delete;
+    CheckpointWriter& operator=(const CheckpointWriter&) = delete;
+
+    ~CheckpointWriter() override {
+        try {
+            close();
+        } catch (...) {
+        }
+    }
+
+    void save(int iteration, const VectorType& x, const VectorType& r, const VectorType& p,
+              const T& rho_old, double relres, double elapsed_time,
+              const algorithms::CGResult<T>& progress) override {
+        std::lock_guard<std::mutex> lock(mutex_);
+        staged_.iteration = iteration;
+        staged_.x = x;
+        staged_.r = r;
+        staged_.p = p;
+        staged_.rho_old = rho_old;
+        staged_.relres = relres;
+        staged_.elapsed_time = elapsed_time;
+        staged_.streamed = progress.diagnostics.streams();
+
+        // staged_.progress holds the history entries the writer thread has not taken yet
+        auto& staged = staged_.progress;
+        staged.diagnostics = progress.diagnostics;
+        staged.diagnostics.sink = nullptr;
+        staged.initial_residual_norm = progress.initial_residual_norm;
+        staged.final_relerr_2 = progress.final_relerr_2;
+        staged.final_relerr_A = progress.final_relerr_A;
+        staged.history_entries = progress.history_entries;
+        appendSince(staged.hist_relres_2, progress.hist_relres_2, saved_residuals_);
+        appendSince(staged.hist_relerr_2, progress.hist_relerr_2, saved_errors_);
+        appendSince(staged.hist_relerr_A, progress.hist_relerr_A, saved_errors_);
+        appendSince(staged.hist_relerr_iter, progress.hist_relerr_iter, saved_errors_);
+        saved_residuals_ = progress.hist_relres_2.size();
+        saved_errors_ = progress.hist_relerr_2.size();
+        staged_ready_ = true;
+        wake_writer_.notify_one();
+    }
+
+    /// Write the last staged state, stop the writer thread
+    /// @throws std::runtime_error if any write failed
+    void close() {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (stop_) {
+                return;
+            }
+            stop_ = true;
+        }
+        wake_writer_.notify_one();
+        writer_.join();
+        if (!error_.empty()) {
+            throw std::runtime_error(error_);
+        }
+    }
+
+    const std::string& path() const { return path_; }
+
+    /// Checkpoints written so far
+    int written() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return written_;
+    }
+
+    /// Iteration of the last written checkpoint (-1 if none)
+    int last_iteration() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return last_iteration_;
+    }
+
+private:
+    template<typename Entry>
+    static void appendSince(std::vector<Entry>& to, const std::vector<Entry>& from, std::size_t first) {
+        to.insert(to.end(), from.begin() + static_cast<std::ptrdiff_t>(std::min(first, from.size())), from.end());
+    }
+
+    /// Move the staged state into writing_ (mutex_ held): the vectors are
+    /// swapped, the new history entries appended to the full histories
+    void takeStaged() {
+        writing_.iteration = staged_.iteration;
+        std::swap(writing_.x, staged_.x);
+        std::swap(writing_.r, staged_.r);
+        std::swap(writing_.p, staged_.p);
+        writing_.rho_old = staged_.rho_old;
+        writing_.relres = staged_.relres;
+        writing_.elapsed_time = staged_.elapsed_time;
+        writing_.streamed = staged_.streamed;
+
+        auto& from = staged_.progress;
+        auto& to = writing_.progress;
+        to.diagnostics = from.diagnostics;
+        to.initial_residual_norm = from.initial_residual_norm;
+        to.final_relerr_2 = from.final_relerr_2;
+        to.final_relerr_A = from.final_relerr_A;
+        to.history_entries = from.history_entries;
+        appendSince(to.hist_relres_2, from.hist_relres_2, 0);
+        appendSince(to.hist_relerr_2, from.hist_relerr_2, 0);
+        appendSince(to.hist_relerr_A, from.hist_relerr_A, 0);
+        appendSince(to.hist_relerr_iter, from.hist_relerr_iter, 0);
+        from.hist_relres_2.clear();
+        from.hist_relerr_2.clear();
+        from.hist_relerr_A.clear();
+        from.hist_relerr_iter.clear();
+    }
+
+    void run() {
+        std::unique_lock<std::mutex> lock(mutex_);
+        for (;;) {
+            wake_writer_.wait(lock, [&] { return stop_ || staged_ready_; });
+            if (!staged_ready_) {
+                return;  // stop_ with nothing left to write
+            }
+            takeStaged();
+            staged_ready_ = false;
+            lock.unlock();
+
+            std::string error;
+            try {
+                if (history_ && writing_.streamed) {
+                    history_->sync(writing_.progress.history_entries);
+                }
+                writeCheckpoint(path_, writing_, rhs_checksum_);
+            } catch (const std::exception& e) {
+                error = e.what();
+            }
+
+            lock.lock();
+            if (error.empty()) {
+                ++written_;
+                last_iteration_ = writing_.iteration;
+            } else if (error_.empty()) {
+                error_ = error;
+            }
+        }
+    }
+
+    std::string path_;
+    std::uint64_t rhs_checksum_;
+    HistoryStream* history_;             ///< Synced before each checkpoint (not owned)
+
+    mutable std::mutex mutex_;
+    std::condition_variable wake_writer_;
+    algorithms::CGState<T> staged_;      ///< Latest state from save() (histories: entries not yet taken)
+    algorithms::CGState<T> writing_;     ///< State being written, full histories (writer thread only)
+    std::size_t saved_residuals_{0};     ///< hist_relres_2 entries handed over by save()
+    std::size_t saved_errors_{0};        ///< hist_relerr_* entries handed over by save()
+    bool staged_ready_{false};
+    bool stop_{false};
+    int written_{0};
+    int last_iteration_{-1};
+    std::string error_;                  ///< First write error
+    std::thread writer_;
+};
+
+} // namespace io
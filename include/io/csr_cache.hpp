@@ -0,0 +1,237 @@
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <cstdio>
+#include <string>
+#include <vector>
+#include <optional>
+#include <filesystem>
+#include <fstream>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// ==============================================================================
+//  Binary CSR cache for Matrix Market inputs
+//
+//  Layout (native endianness, little-endian on all supported targets):
+//    CsrCacheHeader (64 bytes)
+//    row_ptr  int32[nrows + 1]
+//    col_idx  int32[nnz]
+//    (zero padding to 8 bytes)
+//    values   double[nnz]
+//
+//  The header records the size and modification time of the source .mtx, so
+//  a cache goes stale automatically when the matrix file changes, and a
+//  checksum over the three arrays that is verified on every load.
+// ==============================================================================
+
+namespace io {
+
+/// Read-only view of a double-precision CSR matrix
+struct CsrView {
+    int nrows{0};
+    int ncols{0};
+    std::int64_t nnz{0};
+    const int* row_ptr{nullptr};
+    const int* col_idx{nullptr};
+    const double* values{nullptr};
+};
+
+/// Matrix in CSR form with double values, as parsed from a Matrix Market file
+struct CsrMatrixData {
+    int nrows{0};
+    int ncols{0};
+    std::vector<int> row_ptr;     ///< nrows + 1 offsets
+    std::vector<int> col_idx;     ///< Column of each stored entry (sorted within a row)
+    std::vector<double> values;   ///< Value of each stored entry
+
+    CsrView view() const {
+        return {nrows, ncols, static_cast<std::int64_t>(values.size()),
+                row_ptr.data(), col_idx.data(), values.data()};
+    }
+};
+
+struct CsrCacheHeader {
+    char magic[8];                 ///< "BLYCSR01"
+    std::int64_t nrows;
+    std::int64_t ncols;
+    std::int64_t nnz;
+    std::uint64_t source_size;     ///< Size of the .mtx the cache was built from
+    std::int64_t source_mtime;     ///< Modification time of that .mtx (file clock ticks)
+    std::uint64_t checksum;        ///< csrChecksum over row_ptr, col_idx, values
+    std::uint64_t reserved;
+};
+static_assert(sizeof(CsrCacheHeader) == 64, "cache header layout");
+
+inline constexpr char csr_cache_magic[8] = {'B', 'L', 'Y', 'C', 'S', 'R', '0', '1'};
+
+/// Cache file path for a Matrix Market file (stored next to it)
+inline std::string csrCachePath(const std::string& mtx_path) {
+    return mtx_path + ".csrbin";
+}
+
+/// 64-bit checksum of a byte range, mixed one 8-byte word at a time
+inline std::uint64_t csrChecksum(const void* data, std::size_t bytes, std::uint64_t h = 0xcbf29ce484222325ULL) {
+    const unsigned char* p = static_cast<const unsigned char*>(data);
+    std::size_t i = 0;
+    for (; i + 8 <= bytes; i += 8) {
+        std::uint64_t word;
+        std::memcpy(&word, p + i, 8);
+        h = (h ^ word) * 0x100000001b3ULL;
+        h ^= h >> 29;
+    }
+    for (; i < bytes; ++i) {
+        h = (h ^ p[i]) * 0x100000001b3ULL;
+    }
+    return h;
+}
+
+inline std::uint64_t csrChecksum(const CsrView& csr) {
+    std::uint64_t h = csrChecksum(csr.row_ptr, sizeof(int) * (csr.nrows + 1));
+    h = csrChecksum(csr.col_idx, sizeof(int) * csr.nnz, h);
+    return csrChecksum(csr.values, sizeof(double) * csr.nnz, h);
+}
+
+namespace detail {
+
+struct SourceStamp {
+    std::uint64_t size;
+    std::int64_t mtime;
+};
+
+inline std::optional<SourceStamp> sourceStamp(const std::string& path) {
+    std::error_code ec;
+    auto size = std::filesystem::file_size(path, ec);
+    if (ec) return std::nullopt;
+    auto mtime = std::filesystem::last_write_time(path, ec);
+    if (ec) return std::nullopt;
+    return SourceStamp{size, static_cast<std::int64_t>(mtime.time_since_epoch().count())};
+}
+
+/// Byte offsets of the arrays following the header
+struct CsrCacheLayout {
+    std::size_t row_ptr, col_idx, values, total;
+
+    CsrCacheLayout(std::int64_t nrows, std::int64_t nnz) {
+        row_ptr = sizeof(CsrCacheHeader);
+        col_idx = row_ptr + sizeof(int) * (nrows + 1);
+        values = (col_idx + sizeof(int) * nnz + 7) & ~std::size_t{7};
+        total = values + sizeof(double) * nnz;
+    }
+};
+
+} // namespace detail
+
+/// Memory-mapped, validated CSR cache file
+class MappedCsrCache {
+public:
+    MappedCsrCache(const MappedCsrCache&) = delete;
+    MappedCsrCache& operator=(const MappedCsrCache&) = delete;
+    MappedCsrCache(MappedCsrCache&& other) noexcept
+        : data_(other.data_), size_(other.size_), view_(other.view_) {
+        other.data_ = nullptr;
+        other.size_ = 0;
+    }
+    ~MappedCsrCache() {
+        if (data_) munmap(data_, size_);
+    }
+
+    /// Map the cache for mtx_path; nullopt if missing, stale, or corrupt
+    static std::optional<MappedCsrCache> open(const std::string& mtx_path) {
+        auto stamp = detail::sourceStamp(mtx_path);
+        if (!stamp) return std::nullopt;
+
+        int fd = ::open(csrCachePath(mtx_path).c_str(), O_RDONLY);
+        if (fd < 0) return std::nullopt;
+        struct stat st;
+        if (fstat(fd, &st) != 0 || static_cast<std::size_t>(st.st_size) < sizeof(CsrCacheHeader)) {
+            ::close(fd);
+            return std::nullopt;
+        }
+        const std::size_t size = static_cast<std::size_t>(st.st_size);
+        void* data = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+        ::close(fd);
+        if (data == MAP_FAILED) return std::nullopt;
+
+        MappedCsrCache cache(data, size);
+        if (!cache.validate(*stamp)) return std::nullopt;
+        return cache;
+    }
+
+    const CsrView& view() const { return view_; }
+
+private:
+    MappedCsrCache(void* data, std::size_t size) : data_(data), size_(size) {}
+
+    bool validate(const detail::SourceStamp& stamp) {
+        CsrCacheHeader header;
+        std::memcpy(&header, data_, sizeof(header));
+        if (std::memcmp(header.magic, csr_cache_magic, sizeof(header.magic)) != 0 ||
+            header.source_size != stamp.size || header.source_mtime != stamp.mtime ||
+            header.nrows < 0 || header.ncols < 0 || header.nnz < 0) {
+            return false;
+        }
+        detail::CsrCacheLayout layout(header.nrows, header.nnz);
+        if (layout.total != size_) return false;
+
+        const char* base = static_cast<const char*>(data_);
+        view_.nrows = static_cast<int>(header.nrows);
+        view_.ncols = static_cast<int>(header.ncols);
+        view_.nnz = header.nnz;
+        view_.row_ptr = reinterpret_cast<const int*>(base + layout.row_ptr);
+        view_.col_idx = reinterpret_cast<const int*>(base + layout.col_idx);
+        view_.values = reinterpret_cast<const double*>(base + layout.values);
+        return csrChecksum(view_) == header.checksum;
+    }
+
+    void* data_{nullptr};
+    std::size_t size_{0};
+    CsrView view_;
+};
+
+/// Write the cache for mtx_path (best effort; returns false if it could not be written)
+///
+/// The file is written under a temporary name and renamed into place, so
+/// concurrent runs never map a partially written cache.
+inline bool writeCsrCache(const std::string& mtx_path, const CsrView& csr) {
+    auto stamp = detail::sourceStamp(mtx_path);
+    if (!stamp) return false;
+
+    CsrCacheHeader header{};
+    std::memcpy(header.magic, csr_cache_magic, sizeof(header.magic));
+    header.nrows = csr.nrows;
+    header.ncols = csr.ncols;
+    header.nnz = csr.nnz;
+    header.source_size = stamp->size;
+    header.source_mtime = stamp->mtime;
+    header.checksum = csrChecksum(csr);
+
+    detail::CsrCacheLayout layout(csr.nrows, csr.nnz);
+    const std::string path = csrCachePath(mtx_path);
+    const std::string tmp_path = path + ".tmp" + std::to_string(::getpid());
+    {
+        std::ofstream out(tmp_path, std::ios::binary | std::ios::trunc);
+        if (!out) return false;
+        const char zeros[8] = {};
+        out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        out.write(reinterpret_cast<const char*>(csr.row_ptr), sizeof(int) * (csr.nrows + 1));
+        out.write(reinterpret_cast<const char*>(csr.col_idx), sizeof(int) * csr.nnz);
+        out.write(zeros, layout.values - (layout.col_idx + sizeof(int) * csr.nnz));
+        out.write(reinterpret_cast<const char*>(csr.values), sizeof(double) * csr.nnz);
+        if (!out) {
+            out.close();
+            std::remove(tmp_path.c_str());
+            return false;
+        }
+    }
+    if (std::rename(tmp_path.c_str(), path.c_str()) != 0) {
+        std::remove(tmp_path.c_str());
+        return false;
+    }
+    return true;
+}
+
+} // namespace io
@@ -0,0 +1,244 @@
+#pragma once
+
+#include "algorithms/conjugate_gradient.hpp"
+#include <cmath>
+#include <cstdio>
+#include <chrono>
+#include <string>
+#include <vector>
+#include <mutex>
+#include <thread>
+#include <condition_variable>
+#include <stdexcept>
+#include <algorithm>
+#include <optional>
+#include <fstream>
+#include <filesystem>
+#include <unistd.h>
+
+// ==============================================================================
+//  Streaming convergence history (CSV, append-only)
+//
+//  Layout: a header line, then one line per history entry, in the order the
+//  solver records them:
+//    iter,relres_2,relerr_2,relerr_A
+//    0,1,,                           <- residual entry
+//    0,,1,1                          <- error entry (Full diagnostics)
+//    1,0.93285416236582318,,
+//  Values are printed with 17 significant digits, so they read back as the
+//  exact doubles CGResult would have held. Missing fields are empty.
+//
+//  The solver thread only appends fixed-size records to a buffer under a
+//  mutex; a background thread formats and writes them in chunks and flushes
+//  the file at least every flush_interval, so `tail -f` follows a running
+//  solve. Memory is bounded by max_pending records: a solver that outruns
+//  the disk waits for the writer.
+//
+//  A run resumed from a checkpoint reopens the stream at the checkpoint's
+//  history offset: later entries (written after the checkpoint, before the
+//  interruption) are cut, and the resumed solve appends from there. The
+//  checkpoint writer calls sync() before committing a checkpoint, so the
+//  stream on disk always reaches the offset of the last checkpoint.
+// ==============================================================================
+
+namespace io {
+
+/// Convergence history sink that streams entries to a CSV file
+class HistoryStream : public algorithms::HistorySink {
+public:
+    /// Open (truncate) @p path and start the writer thread
+    /// @param resume_at Keep the first *resume_at entries of an existing stream and append
+    ///                  after them (resuming from a checkpoint taken at that history offset)
+    /// @param flush_interval Maximum delay before recorded entries reach the file
+    /// @param max_pending Entries buffered before the solver waits for the writer
+    explicit HistoryStream(const std::string& path,
+                           std::optional<std::size_t> resume_at = std::nullopt,
+                           std::chrono::milliseconds flush_interval = std::chrono::milliseconds(1000),
+                           std::size_t max_pending = 1 << 16)
+        : path_(path), flush_interval_(flush_interval), max_pending_(std::max<std::size_t>(max_pending, 2)) {
+        if (resume_at) {
+            truncate(*resume_at);
+            recorded_ = *resume_at;
+            flushed_ = *resume_at;
+        }
+        file_ = std::fopen(path.c_str(), resume_at ? "a" : "w");
+        if (!file_) {
+            throw std::runtime_error("Cannot open history stream: " + path);
+        }
+        if (!resume_at) {
+            std::fputs(header, file_);
+        }
+        pending_.reserve(max_pending_);
+        writing_.reserve(max_pending_);
+        writer_ = std::thread([this] { run(); });
+    }
+
+    HistoryStream(const HistoryStream&) = delete;
+    HistoryStream& operator=(const HistoryStream&) = delete;
+
+    ~HistoryStream() override {
+        try {
+            close();
+        } catch (...) {
+        }
+    }
+
+    void residual(int iter, double relres_2) override {
+        push({iter, Record::Residual, relres_2, 0.0});
+    }
+
+    void error(int iter, double relerr_2, double relerr_A) override {
+        push({iter, Record::Error, relerr_2, relerr_A});
+    }
+
+    /// Write all recorded entries, stop the writer thread and close the file
+    /// @throws std::runtime_error if any write failed
+    void close() {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (!file_) {
+                return;
+            }
+            stop_ = true;
+        }
+        wake_writer_.notify_one();
+        writer_.join();
+        bool ok = !failed_ && ::fsync(fileno(file_)) == 0;
+        ok = std::fclose(file_) == 0 && ok;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            file_ = nullptr;
+        }
+        flushed_cv_.notify_all();
+        if (!ok) {
+            throw std::runtime_error("Failed writing history stream: " + path_);
+        }
+    }
+
+    /// Block until the first `entries` entries are written and on stable storage
+    ///
+    /// Called by io::CheckpointWriter before it commits a checkpoint whose
+    /// history offset is `entries`, so a resume always finds them in the file.
+    /// @throws std::runtime_error if writing the stream failed
+    /// Must not run concurrently with close().
+    void sync(std::size_t entries) {
+        std::unique_lock<std::mutex> lock(mutex_);
+        entries = std::min(entries, recorded_);
+        sync_requested_ = std::max(sync_requested_, entries);
+        wake_writer_.notify_one();
+        flushed_cv_.wait(lock, [&] { return flushed_ >= entries || failed_ || !file_; });
+        if (failed_) {
+            throw std::runtime_error("Failed writing history stream: " + path_);
+        }
+        std::FILE* file = file_;
+        lock.unlock();  // the solver keeps recording while the disk syncs
+        if (file && ::fsync(fileno(file)) != 0) {
+            throw std::runtime_error("Cannot sync history stream: " + path_);
+        }
+    }
+
+    const std::string& path() const { return path_; }
+
+    /// Entries in the stream (including those kept by resume_at)
+    std::size_t entries() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return recorded_;
+    }
+
+private:
+    static constexpr const char* header = "iter,relres_2,relerr_2,relerr_A\n";
+
+    /// Cut the existing stream after its first `entries` entries
+    void truncate(std::size_t entries) {
+        std::ifstream in(path_, std::ios::binary);
+        std::string line;
+        if (!in || !std::getline(in, line) || line + "\n" != header) {
+            throw std::runtime_error("Cannot resume history stream (missing or not a history stream): " + path_);
+        }
+        for (std::size_t i = 0; i < entries; ++i) {
+            if (!std::getline(in, line) || in.eof()) {
+                throw std::runtime_error("History stream " + path_ + " has fewer than " +
+                                         std::to_string(entries) + " entries");
+            }
+        }
+        const auto keep = static_cast<std::uintmax_t>(in.tellg());
+        in.close();
+        std::filesystem::resize_file(path_, keep);
+    }
+
+    struct Record {
+        enum Kind : int { Residual, Error };
+        int iter;
+        Kind kind;
+        double a;  ///< relres_2 or relerr_2
+        double b;  ///< relerr_A
+    };
+
+    void push(const Record& record) {
+        std::unique_lock<std::mutex> lock(mutex_);
+        writer_done_.wait(lock, [&] { return pending_.size() < max_pending_; });
+        pending_.push_back(record);
+        ++recorded_;
+        if (pending_.size() == max_pending_ / 2) {
+            wake_writer_.notify_one();
+        }
+    }
+
+    void run() {
+        std::string text;
+        char line[96];
+        std::unique_lock<std::mutex> lock(mutex_);
+        for (;;) {
+            wake_writer_.wait_for(lock, flush_interval_, [&] {
+                return stop_ || pending_.size() >= max_pending_ / 2 || sync_requested_ > flushed_;
+            });
+            writing_.swap(pending_);
+            const std::size_t flushed = recorded_;
+            const bool stopping = stop_;
+            lock.unlock();
+            writer_done_.notify_all();
+
+            bool failed = false;
+            text.clear();
+            for (const Record& record : writing_) {
+                int length = record.kind == Record::Residual
+                    ? std::snprintf(line, sizeof(line), "%d,%.17g,,\n", record.iter, record.a)
+                    : std::snprintf(line, sizeof(line), "%d,,%.17g,%.17g\n", record.iter, record.a, record.b);
+                text.append(line, length);
+            }
+            writing_.clear();
+            if (!text.empty() &&
+                (std::fwrite(text.data(), 1, text.size(), file_) != text.size() || std::fflush(file_) != 0)) {
+                failed = true;
+            }
+
+            lock.lock();
+            failed_ = failed_ || failed;
+            flushed_ = flushed;
+            flushed_cv_.notify_all();
+            if (stopping && pending_.empty()) {
+                return;
+            }
+        }
+    }
+
+    std::string path_;
+    std::chrono::milliseconds flush_interval_;
+    std::size_t max_pending_;
+    std::FILE* file_{nullptr};
+
+    mutable std::mutex mutex_;
+    std::condition_variable wake_writer_;   ///< Entries to write, or close()
+    std::condition_variable writer_done_;   ///< Buffer taken over by the writer
+    std::condition_variable flushed_cv_;    ///< flushed_ advanced (sync())
+    std::vector<Record> pending_;           ///< Recorded, not yet taken by the writer
+    std::vector<Record> writing_;           ///< Being written (writer thread only)
+    std::size_t recorded_{0};
+    std::size_t flushed_{0};                ///< Entries written and flushed to the file
+    std::size_t sync_requested_{0};         ///< Highest entry count a sync() waits for
+    bool stop_{false};
+    bool failed_{false};                    ///< Set by the writer thread
+    std::thread writer_;
+};
+
+} // namespace io
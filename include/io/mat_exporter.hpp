@@ -33,7 +33,7 @@ public:
 
 private:
     /// Get precision digits for metadata
-    /// @param precision_name Precision level name (double, dd, dq, qx)
+    /// @param precision_name Precision level name (double, dd, dq, qx, or a refinement mode dd-ir, dq-ir, qx-ir)
     /// @return Number of decimal digits for the precision level
     static int get_precision_digits(const std::string& precision_name);
 };
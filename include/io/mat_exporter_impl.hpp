@@ -41,6 +41,22 @@ bool MatExporter::export_convergence_data(
         iterations_performed = static_cast<double>(result.iterations_performed);
         metadata.setField(iterations_performed);
         
+        if (result.outer_iterations > 0) {
+            matioCpp::Element<double> outer_iterations("outer_iterations");
+            outer_iterations = static_cast<double>(result.outer_iterations);
+            metadata.setField(outer_iterations);
+            
+            matioCpp::Element<double> inner_iterations("inner_iterations");
+            inner_iterations = static_cast<double>(result.inner_iterations);
+            metadata.setField(inner_iterations);
+        }
+        
+        metadata.setField(matioCpp::String("diagnostics", algorithms::to_string(result.diagnostics.mode)));
+        
+        matioCpp::Element<double> diagnostics_interval("diagnostics_interval");
+        diagnostics_interval = static_cast<double>(result.diagnostics.interval);
+        metadata.setField(diagnostics_interval);
+        
         matioCpp::Element<double> computation_time("computation_time");
         computation_time = result.computation_time;
         metadata.setField(computation_time);
@@ -55,15 +71,15 @@ bool MatExporter::export_convergence_data(
         metadata.setField(final_true_relres_2norm);
         
         // Final error metrics (if available)
-        if (!result.hist_relerr_2.empty()) {
+        if (!std::isnan(result.final_relerr_2)) {
             matioCpp::Element<double> final_relerr_2norm("final_relerr_2norm");
-            final_relerr_2norm = result.hist_relerr_2.back();
+            final_relerr_2norm = result.final_relerr_2;
             metadata.setField(final_relerr_2norm);
         }
         
-        if (!result.hist_relerr_A.empty()) {
+        if (!std::isnan(result.final_relerr_A)) {
             matioCpp::Element<double> final_relerr_Anorm("final_relerr_Anorm");
-            final_relerr_Anorm = result.hist_relerr_A.back();
+            final_relerr_Anorm = result.final_relerr_A;
             metadata.setField(final_relerr_Anorm);
         }
         
@@ -72,16 +88,25 @@ bool MatExporter::export_convergence_data(
         // --- Convergence history section ---
         matioCpp::Struct convergence("convergence");
         
-        // Create iteration vector
-        std::vector<double> iterations;
-        for (size_t i = 0; i < result.hist_relres_2.size(); ++i) {
-            iterations.push_back(static_cast<double>(i));
+        // Residual history (recorded every iteration unless diagnostics are "none")
+        if (!result.hist_relres_2.empty()) {
+            std::vector<double> iterations;
+            for (size_t i = 0; i < result.hist_relres_2.size(); ++i) {
+                iterations.push_back(static_cast<double>(i));
+            }
+            
+            convergence.setField(matioCpp::Vector<double>("hist_iterations", iterations));
+            convergence.setField(matioCpp::Vector<double>("hist_relres_2", result.hist_relres_2));
         }
         
-        convergence.setField(matioCpp::Vector<double>("hist_iterations", iterations));
-        convergence.setField(matioCpp::Vector<double>("hist_relres_2", result.hist_relres_2));
-        convergence.setField(matioCpp::Vector<double>("hist_relerr_2", result.hist_relerr_2));
-        convergence.setField(matioCpp::Vector<double>("hist_relerr_A", result.hist_relerr_A));
+        // Error history (only with "full" diagnostics, possibly every k iterations)
+        if (!result.hist_relerr_2.empty()) {
+            std::vector<double> relerr_iterations(result.hist_relerr_iter.begin(),
+                                                  result.hist_relerr_iter.end());
+            convergence.setField(matioCpp::Vector<double>("hist_relerr_iterations", relerr_iterations));
+            convergence.setField(matioCpp::Vector<double>("hist_relerr_2", result.hist_relerr_2));
+            convergence.setField(matioCpp::Vector<double>("hist_relerr_A", result.hist_relerr_A));
+        }
         
         // Add final iteration number
         matioCpp::Element<double> iter_final("iter_final");
@@ -113,9 +138,9 @@ bool MatExporter::export_convergence_data(
 
 inline int MatExporter::get_precision_digits(const std::string& precision_name) {
     if (precision_name == "double") return 15;
-    if (precision_name == "dd") return 30;
-    if (precision_name == "dq") return 66;
-    if (precision_name == "qx") return 33;
+    if (precision_name == "dd" || precision_name == "dd-ir") return 30;
+    if (precision_name == "dq" || precision_name == "dq-ir") return 66;
+    if (precision_name == "qx" || precision_name == "qx-ir") return 33;
     return 15; // Default to double precision
 }
 
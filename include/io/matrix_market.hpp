@@ -1,83 +1,206 @@
 #pragma once
 
 #include "bailey/precision_traits.hpp"
+#include "bailey/symmetric_csr.hpp"
+#include "io/csr_cache.hpp"
+#include <fast_matrix_market/fast_matrix_market.hpp>
 #include <fstream>
 #include <stdexcept>
 #include <vector>
-#include <sstream>
+#include <algorithm>
+#include <numeric>
 #include <Eigen/Sparse>
 
 namespace io {
 
-template<typename T>
-typename bailey::PrecisionTraits<T>::matrix_type
-loadMatrixMarket(const std::string& filename) {
-    using Traits = bailey::PrecisionTraits<T>;
-    using MatrixType = typename Traits::matrix_type;
-    
-    std::ifstream file(filename);
+/// Where loadMatrixMarket obtained the matrix from
+enum class MatrixSource {
+    MatrixMarket,   ///< Parsed the .mtx file
+    Cache           ///< Mapped the binary CSR cache next to it
+};
+
+/// Parse a Matrix Market coordinate file into double-precision CSR
+///
+/// The file is parsed by fast_matrix_market (multi-threaded, directly into
+/// index/value arrays). Symmetric and skew-symmetric matrices are expanded
+/// to both triangles while scattering into CSR; duplicate entries are summed.
+inline CsrMatrixData readMatrixMarketCsr(const std::string& filename) {
+    std::ifstream file(filename, std::ios::binary);
     if (!file.is_open()) {
         throw std::runtime_error("Matrix Market file not found: " + filename);
     }
-    
-    std::string line;
-    // Read header line
-    if (!std::getline(file, line) || line.find("%%MatrixMarket") != 0) {
-        throw std::runtime_error("Invalid Matrix Market file format");
+
+    fast_matrix_market::matrix_market_header header;
+    fast_matrix_market::read_options options;
+    options.parallel_ok = true;
+    options.generalize_symmetry = false;  // mirrored below, without extra triplets
+
+    std::vector<int> rows, cols;
+    std::vector<double> coo_values;
+    try {
+        fast_matrix_market::read_matrix_market_triplet(file, header, rows, cols, coo_values, options);
+    } catch (const std::exception& e) {
+        throw std::runtime_error("Invalid Matrix Market file " + filename + ": " + e.what());
     }
-    
-    // Check if matrix is symmetric
-    bool is_symmetric = line.find("symmetric") != std::string::npos;
-    
-    // Skip comment lines
-    while (std::getline(file, line) && line[0] == '%') {}
-    
-    // Read dimensions and nnz
-    std::istringstream iss(line);
-    int nrows, ncols, nnz;
-    if (!(iss >> nrows >> ncols >> nnz)) {
-        throw std::runtime_error("Failed to read matrix dimensions");
+
+    const bool mirror = header.symmetry != fast_matrix_market::general;
+    const double mirror_sign = header.symmetry == fast_matrix_market::skew_symmetric ? -1.0 : 1.0;
+
+    CsrMatrixData csr;
+    csr.nrows = static_cast<int>(header.nrows);
+    csr.ncols = static_cast<int>(header.ncols);
+    const std::size_t entries = coo_values.size();
+
+    // Count entries per row (including mirrored ones)
+    csr.row_ptr.assign(csr.nrows + 1, 0);
+    for (std::size_t k = 0; k < entries; ++k) {
+        if (rows[k] < 0 || rows[k] >= csr.nrows || cols[k] < 0 || cols[k] >= csr.ncols) {
+            throw std::runtime_error("Matrix entry index out of range in " + filename);
+        }
+        ++csr.row_ptr[rows[k] + 1];
+        if (mirror && rows[k] != cols[k]) {
+            ++csr.row_ptr[cols[k] + 1];
+        }
     }
-    
-    std::vector<Eigen::Triplet<T>> triplets;
-    // Reserve more space for symmetric matrices (need to store both triangles)
-    triplets.reserve(is_symmetric ? 2 * nnz : nnz);
-    
-    // Read matrix entries
-    for (int i = 0; i < nnz; ++i) {
-        if (!std::getline(file, line)) {
-            throw std::runtime_error("Unexpected end of file");
+    std::partial_sum(csr.row_ptr.begin(), csr.row_ptr.end(), csr.row_ptr.begin());
+
+    // Scatter in file order (deterministic), then sort each row by column
+    std::vector<int> next(csr.row_ptr.begin(), csr.row_ptr.end() - 1);
+    csr.col_idx.resize(csr.row_ptr.back());
+    csr.values.resize(csr.row_ptr.back());
+    for (std::size_t k = 0; k < entries; ++k) {
+        int pos = next[rows[k]]++;
+        csr.col_idx[pos] = cols[k];
+        csr.values[pos] = coo_values[k];
+        if (mirror && rows[k] != cols[k]) {
+            pos = next[cols[k]]++;
+            csr.col_idx[pos] = rows[k];
+            csr.values[pos] = mirror_sign * coo_values[k];
         }
-        
-        std::istringstream entry_iss(line);
-        int row, col;
-        double value;
-        if (!(entry_iss >> row >> col >> value)) {
-            throw std::runtime_error("Failed to parse matrix entry");
+    }
+
+    // Sort rows and sum duplicates; the per-row entry count may shrink
+    std::vector<int> row_nnz(csr.nrows);
+    #pragma omp parallel
+    {
+        std::vector<std::pair<int, double>> row;
+        #pragma omp for schedule(dynamic, 256)
+        for (int i = 0; i < csr.nrows; ++i) {
+            const int begin = csr.row_ptr[i];
+            const int end = csr.row_ptr[i + 1];
+            row.clear();
+            for (int k = begin; k < end; ++k) {
+                row.emplace_back(csr.col_idx[k], csr.values[k]);
+            }
+            std::stable_sort(row.begin(), row.end(),
+                             [](const auto& a, const auto& b) { return a.first < b.first; });
+            int out = begin;
+            for (std::size_t k = 0; k < row.size(); ++k) {
+                if (out > begin && csr.col_idx[out - 1] == row[k].first) {
+                    csr.values[out - 1] += row[k].second;
+                } else {
+                    csr.col_idx[out] = row[k].first;
+                    csr.values[out] = row[k].second;
+                    ++out;
+                }
+            }
+            row_nnz[i] = out - begin;
         }
-        
-        // Convert to 0-indexed
-        row -= 1;
-        col -= 1;
-        
-        triplets.emplace_back(row, col, T(value));
-        
-        // For symmetric matrices, add the symmetric entry if not on diagonal
-        if (is_symmetric && row != col) {
-            triplets.emplace_back(col, row, T(value));
+    }
+
+    // Compact rows that lost duplicates
+    int out = 0;
+    for (int i = 0; i < csr.nrows; ++i) {
+        const int begin = csr.row_ptr[i];
+        if (out != begin) {
+            std::copy_n(csr.col_idx.begin() + begin, row_nnz[i], csr.col_idx.begin() + out);
+            std::copy_n(csr.values.begin() + begin, row_nnz[i], csr.values.begin() + out);
         }
+        csr.row_ptr[i] = out;
+        out += row_nnz[i];
+    }
+    csr.row_ptr[csr.nrows] = out;
+    csr.col_idx.resize(out);
+    csr.values.resize(out);
+
+    return csr;
+}
+
+/// Convert double CSR data into a precision-T CSR matrix (values converted in parallel)
+template<typename T>
+typename bailey::PrecisionTraits<T>::matrix_type csrToMatrix(const CsrView& csr) {
+    using MatrixType = typename bailey::PrecisionTraits<T>::matrix_type;
+    static_assert(MatrixType::IsRowMajor, "CSR data requires a row-major matrix type");
+
+    MatrixType matrix(csr.nrows, csr.ncols);
+    const Eigen::Index nnz = static_cast<Eigen::Index>(csr.nnz);
+    matrix.resizeNonZeros(nnz);
+    std::copy(csr.row_ptr, csr.row_ptr + csr.nrows + 1, matrix.outerIndexPtr());
+    std::copy(csr.col_idx, csr.col_idx + nnz, matrix.innerIndexPtr());
+
+    T* values = matrix.valuePtr();
+    #pragma omp parallel for schedule(static)
+    for (Eigen::Index k = 0; k < nnz; ++k) {
+        values[k] = T(csr.values[k]);
     }
-    
-    MatrixType matrix(nrows, ncols);
-    matrix.setFromTriplets(triplets.begin(), triplets.end());
-    
     return matrix;
 }
 
+namespace detail {
+
+/// Obtain the double CSR data of a Matrix Market file (cache or parse) and pass it to build
+template<typename Build>
+auto withCsr(const std::string& filename, bool use_cache, MatrixSource* source, Build build) {
+    if (use_cache) {
+        if (auto cache = MappedCsrCache::open(filename)) {
+            if (source) *source = MatrixSource::Cache;
+            return build(cache->view());
+        }
+    }
+
+    CsrMatrixData csr = readMatrixMarketCsr(filename);
+    if (use_cache) {
+        writeCsrCache(filename, csr.view());
+    }
+    if (source) *source = MatrixSource::MatrixMarket;
+    return build(csr.view());
+}
+
+} // namespace detail
+
+/// Load a Matrix Market file as a CSR matrix in precision T
+///
+/// With use_cache, a valid binary cache next to the file (csr_cache.hpp) is
+/// memory-mapped instead of parsing; otherwise the file is parsed and the
+/// cache is (re)written for the next run.
+///
+/// @param filename Path of the .mtx file
+/// @param use_cache Read and write the binary CSR cache
+/// @param source If non-null, receives where the matrix came from
+template<typename T>
+typename bailey::PrecisionTraits<T>::matrix_type
+loadMatrixMarket(const std::string& filename, bool use_cache = true, MatrixSource* source = nullptr) {
+    return detail::withCsr(filename, use_cache, source,
+                           [](const CsrView& csr) { return csrToMatrix<T>(csr); });
+}
+
+/// Load a symmetric Matrix Market file keeping only its upper triangle
+///
+/// @throws std::runtime_error if the matrix is not symmetric
+/// @see loadMatrixMarket
+template<typename T>
+bailey::SymmetricCsrMatrix<T>
+loadSymmetricMatrixMarket(const std::string& filename, bool use_cache = true, MatrixSource* source = nullptr) {
+    return detail::withCsr(filename, use_cache, source, [](const CsrView& csr) {
+        return bailey::SymmetricCsrMatrix<T>::fromFullCsr(csr.nrows, csr.ncols, csr.row_ptr, csr.col_idx,
+                                                          csr.values, [](double v) { return T(v); });
+    });
+}
+
 // Template specialization helper for file path construction
-inline std::string constructMatrixPath(const std::string& matrix_name, 
+inline std::string constructMatrixPath(const std::string& matrix_name,
                                      const std::string& base_dir = "/work/inputs") {
     return base_dir + "/" + matrix_name + ".mtx";
 }
 
-} // namespace io
\ No newline at end of file
+} // namespace io
@@ -34,6 +34,15 @@ subroutine dd_mul(a,b,c) bind(C,name="ddmul_")
     c = dc%ddr
 end subroutine
 
+subroutine dd_muld(a,d,c) bind(C,name="ddmuld_")
+    real(c_double), intent(in)  :: a(2), d
+    real(c_double), intent(out) :: c(2)
+    type(dd_real) :: da, dc
+    da%ddr = a
+    dc = da * d
+    c = dc%ddr
+end subroutine
+
 subroutine dd_div(a,b,c) bind(C,name="dddiv_")
     real(c_double), intent(in)  :: a(2), b(2)
     real(c_double), intent(out) :: c(2)
@@ -87,4 +96,76 @@ subroutine dd_tostr(a,nd,s,str_len) bind(C,name="ddtoqd_")
     s(c_len+1) = c_null_char
 end subroutine
 
+! ------------------------------------------------------------------------------
+!  Array-level routines: one C->Fortran call per vector (or row range) instead
+!  of one per flop. Each performs the same dd_real operations in the same
+!  order as the element-wise C++ loop it replaces, so results are identical.
+!  CSR arrays are 0-based (Eigen outerIndexPtr/innerIndexPtr).
+! ------------------------------------------------------------------------------
+
+subroutine dd_axpy(n,alpha,x,y) bind(C,name="ddaxpy_")
+    integer(c_int), intent(in) :: n
+    real(c_double), intent(in)    :: alpha(2), x(2,n)
+    real(c_double), intent(inout) :: y(2,n)
+    type(dd_real) :: da, dx, dy
+    integer :: i
+    da%ddr = alpha
+    do i = 1, n
+        dx%ddr = x(:,i)
+        dy%ddr = y(:,i)
+        dy = dy + da * dx
+        y(:,i) = dy%ddr
+    end do
+end subroutine
+
+subroutine dd_dot(n,x,y,s) bind(C,name="dddot_")
+    integer(c_int), intent(in) :: n
+    real(c_double), intent(in)  :: x(2,n), y(2,n)
+    real(c_double), intent(out) :: s(2)
+    type(dd_real) :: dx, dy, ds
+    integer :: i
+    ds%ddr = 0.0d0
+    do i = 1, n
+        dx%ddr = x(:,i)
+        dy%ddr = y(:,i)
+        ds = ds + dx * dy
+    end do
+    s = ds%ddr
+end subroutine
+
+subroutine dd_spmv_csr(row_begin,row_end,outer,inner,values,p,w) bind(C,name="ddspmv_csr_")
+    integer(c_int), intent(in) :: row_begin, row_end
+    integer(c_int), intent(in) :: outer(0:*), inner(0:*)
+    real(c_double), intent(in)    :: values(2,0:*), p(2,0:*)
+    real(c_double), intent(inout) :: w(2,0:*)
+    type(dd_real) :: dv, dp, ds
+    integer :: i, k
+    do i = row_begin, row_end - 1
+        ds%ddr = 0.0d0
+        do k = outer(i), outer(i+1) - 1
+            dv%ddr = values(:,k)
+            dp%ddr = p(:,inner(k))
+            ds = ds + dv * dp
+        end do
+        w(:,i) = ds%ddr
+    end do
+end subroutine
+
+subroutine dd_spmv_csrd(row_begin,row_end,outer,inner,values,p,w) bind(C,name="ddspmv_csrd_")
+    integer(c_int), intent(in) :: row_begin, row_end
+    integer(c_int), intent(in) :: outer(0:*), inner(0:*)
+    real(c_double), intent(in)    :: values(0:*), p(2,0:*)
+    real(c_double), intent(inout) :: w(2,0:*)
+    type(dd_real) :: dp, ds
+    integer :: i, k
+    do i = row_begin, row_end - 1
+        ds%ddr = 0.0d0
+        do k = outer(i), outer(i+1) - 1
+            dp%ddr = p(:,inner(k))
+            ds = ds + dp * values(k)
+        end do
+        w(:,i) = ds%ddr
+    end do
+end subroutine
+
 end module
\ No newline at end of file
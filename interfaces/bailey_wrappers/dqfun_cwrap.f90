@@ -2,6 +2,7 @@ module dqfun_cwrap
     use iso_c_binding
     use dqmodule
     implicit none
+    private :: dq_load, dq_round, dq_store
 contains
 
 subroutine dq_add(a,b,c) bind(C,name="dqadd_")
@@ -43,6 +44,18 @@ subroutine dq_mul(a,b,c) bind(C,name="dqmul_")
     c(2) = real(dc%dqr(2), c_long_double)
 end subroutine
 
+subroutine dq_muld(a,d,c) bind(C,name="dqmuld_")
+    real(c_long_double), intent(in)  :: a(2)
+    real(c_double), intent(in)  :: d
+    real(c_long_double), intent(out) :: c(2)
+    type(dq_real) :: da, dc
+    da%dqr(1) = real(a(1), dqknd)
+    da%dqr(2) = real(a(2), dqknd)
+    dc = da * real(d, dqknd)
+    c(1) = real(dc%dqr(1), c_long_double)
+    c(2) = real(dc%dqr(2), c_long_double)
+end subroutine
+
 subroutine dq_div(a,b,c) bind(C,name="dqdiv_")
     real(c_long_double), intent(in)  :: a(2), b(2)
     real(c_long_double), intent(out) :: c(2)
@@ -102,4 +115,98 @@ subroutine dq_tostr(a,nd,s,str_len) bind(C,name="dqtoqd_")
     s(c_len+1) = c_null_char
 end subroutine
 
+! ------------------------------------------------------------------------------
+!  Array-level routines: one C->Fortran call per vector (or row range) instead
+!  of one per flop. The scalar wrappers above hand every result back to C as
+!  c_long_double limbs; dq_round applies the same rounding after each
+!  operation here, so these loops reproduce the element-wise C++ loops bit
+!  for bit. CSR arrays are 0-based (Eigen storage).
+! ------------------------------------------------------------------------------
+
+function dq_load(a) result(d)
+    real(c_long_double), intent(in) :: a(2)
+    type(dq_real) :: d
+    d%dqr(1) = real(a(1), dqknd)
+    d%dqr(2) = real(a(2), dqknd)
+end function
+
+function dq_round(a) result(d)
+    type(dq_real), intent(in) :: a
+    type(dq_real) :: d
+    d%dqr(1) = real(real(a%dqr(1), c_long_double), dqknd)
+    d%dqr(2) = real(real(a%dqr(2), c_long_double), dqknd)
+end function
+
+subroutine dq_store(d,a)
+    type(dq_real), intent(in) :: d
+    real(c_long_double), intent(out) :: a(2)
+    a(1) = real(d%dqr(1), c_long_double)
+    a(2) = real(d%dqr(2), c_long_double)
+end subroutine
+
+subroutine dq_axpy(n,alpha,x,y) bind(C,name="dqaxpy_")
+    integer(c_int), intent(in) :: n
+    real(c_long_double), intent(in)    :: alpha(2), x(2,n)
+    real(c_long_double), intent(inout) :: y(2,n)
+    type(dq_real) :: da, dt
+    integer :: i
+    da = dq_load(alpha)
+    do i = 1, n
+        dt = dq_round(da * dq_load(x(:,i)))
+        call dq_store(dq_load(y(:,i)) + dt, y(:,i))
+    end do
+end subroutine
+
+subroutine dq_dot(n,x,y,s) bind(C,name="dqdot_")
+    integer(c_int), intent(in) :: n
+    real(c_long_double), intent(in)  :: x(2,n), y(2,n)
+    real(c_long_double), intent(out) :: s(2)
+    type(dq_real) :: ds, dt
+    integer :: i
+    ds%dqr(1) = 0.0_dqknd
+    ds%dqr(2) = 0.0_dqknd
+    do i = 1, n
+        dt = dq_round(dq_load(x(:,i)) * dq_load(y(:,i)))
+        ds = dq_round(ds + dt)
+    end do
+    call dq_store(ds, s)
+end subroutine
+
+subroutine dq_spmv_csr(row_begin,row_end,outer,inner,values,p,w) bind(C,name="dqspmv_csr_")
+    integer(c_int), intent(in) :: row_begin, row_end
+    integer(c_int), intent(in) :: outer(0:*), inner(0:*)
+    real(c_long_double), intent(in)    :: values(2,0:*), p(2,0:*)
+    real(c_long_double), intent(inout) :: w(2,0:*)
+    type(dq_real) :: ds, dt
+    integer :: i, k
+    do i = row_begin, row_end - 1
+        ds%dqr(1) = 0.0_dqknd
+        ds%dqr(2) = 0.0_dqknd
+        do k = outer(i), outer(i+1) - 1
+            dt = dq_round(dq_load(values(:,k)) * dq_load(p(:,inner(k))))
+            ds = dq_round(ds + dt)
+        end do
+        call dq_store(ds, w(:,i))
+    end do
+end subroutine
+
+subroutine dq_spmv_csrd(row_begin,row_end,outer,inner,values,p,w) bind(C,name="dqspmv_csrd_")
+    integer(c_int), intent(in) :: row_begin, row_end
+    integer(c_int), intent(in) :: outer(0:*), inner(0:*)
+    real(c_double), intent(in)         :: values(0:*)
+    real(c_long_double), intent(in)    :: p(2,0:*)
+    real(c_long_double), intent(inout) :: w(2,0:*)
+    type(dq_real) :: ds, dt
+    integer :: i, k
+    do i = row_begin, row_end - 1
+        ds%dqr(1) = 0.0_dqknd
+        ds%dqr(2) = 0.0_dqknd
+        do k = outer(i), outer(i+1) - 1
+            dt = dq_round(dq_load(p(:,inner(k))) * real(values(k), dqknd))
+            ds = dq_round(ds + dt)
+        end do
+        call dq_store(ds, w(:,i))
+    end do
+end subroutine
+
 end module
\ No newline at end of file
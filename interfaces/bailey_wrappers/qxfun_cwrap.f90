@@ -62,4 +62,64 @@ subroutine qx_tostr(a,nd,s,str_len) bind(C,name="qxtoqd_")
     s(c_len+1) = c_null_char
 end subroutine
 
+! ------------------------------------------------------------------------------
+!  Array-level routines: one C->Fortran call per vector (or row range) instead
+!  of one per flop, with the same operations in the same order as the
+!  element-wise C++ loops. CSR arrays are 0-based (Eigen storage).
+! ------------------------------------------------------------------------------
+
+subroutine qx_axpy(n,alpha,x,y) bind(C,name="qxaxpy_")
+    integer(c_int), intent(in) :: n
+    real(qxknd), intent(in)    :: alpha, x(n)
+    real(qxknd), intent(inout) :: y(n)
+    integer :: i
+    do i = 1, n
+        y(i) = y(i) + alpha * x(i)
+    end do
+end subroutine
+
+subroutine qx_dot(n,x,y,s) bind(C,name="qxdot_")
+    integer(c_int), intent(in) :: n
+    real(qxknd), intent(in)  :: x(n), y(n)
+    real(qxknd), intent(out) :: s
+    integer :: i
+    s = 0.0_qxknd
+    do i = 1, n
+        s = s + x(i) * y(i)
+    end do
+end subroutine
+
+subroutine qx_spmv_csr(row_begin,row_end,outer,inner,values,p,w) bind(C,name="qxspmv_csr_")
+    integer(c_int), intent(in) :: row_begin, row_end
+    integer(c_int), intent(in) :: outer(0:*), inner(0:*)
+    real(qxknd), intent(in)    :: values(0:*), p(0:*)
+    real(qxknd), intent(inout) :: w(0:*)
+    real(qxknd) :: s
+    integer :: i, k
+    do i = row_begin, row_end - 1
+        s = 0.0_qxknd
+        do k = outer(i), outer(i+1) - 1
+            s = s + values(k) * p(inner(k))
+        end do
+        w(i) = s
+    end do
+end subroutine
+
+subroutine qx_spmv_csrd(row_begin,row_end,outer,inner,values,p,w) bind(C,name="qxspmv_csrd_")
+    integer(c_int), intent(in) :: row_begin, row_end
+    integer(c_int), intent(in) :: outer(0:*), inner(0:*)
+    real(c_double), intent(in) :: values(0:*)
+    real(qxknd), intent(in)    :: p(0:*)
+    real(qxknd), intent(inout) :: w(0:*)
+    real(qxknd) :: s
+    integer :: i, k
+    do i = row_begin, row_end - 1
+        s = 0.0_qxknd
+        do k = outer(i), outer(i+1) - 1
+            s = s + p(inner(k)) * real(values(k), qxknd)
+        end do
+        w(i) = s
+    end do
+end subroutine
+
 end module
\ No newline at end of file
@@ -0,0 +1,371 @@
+#include "bailey/precision_traits.hpp"
+#include "algorithms/cg_kernels.hpp"
+#include "io/matrix_market.hpp"
+#include <iostream>
+#include <iomanip>
+#include <fstream>
+#include <sstream>
+#include <chrono>
+#include <ctime>
+#include <cmath>
+#include <string>
+#include <vector>
+#include <functional>
+#include <filesystem>
+#include <stdexcept>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+// Microbenchmarks for Bailey arithmetic and the CG kernels, in the style of
+// Google Benchmark: each case runs for a growing number of iterations until
+// it takes at least --min-time seconds, and is reported per iteration with
+// an items/s rate. --json writes the results in Google Benchmark's JSON
+// layout (context + benchmarks), so its compare tooling can diff two runs.
+//
+//   scalar:  add, mul, div, sqrt          over a 1024-element array (item = one op)
+//   vector:  dot, axpy (algorithms::kernels, PrecisionTraits vector_type)
+//   matrix:  spmv on the given .mtx files (items = non-zeros)
+//
+// for double, DD, DQ and QX.
+
+namespace {
+
+struct Options {
+    double min_time{0.2};
+    std::vector<std::size_t> sizes{1 << 10, 1 << 16, 1 << 20};
+    std::vector<std::string> matrices{"nos5", "bcsstk13", "LF10000"};
+    std::string input_dir{"inputs"};
+    std::string filter;
+    std::string json_file;
+};
+
+struct Result {
+    std::string name;
+    long long iterations;
+    double real_ns;      // Wall time per iteration
+    double cpu_ns;       // Process CPU time per iteration (all threads)
+    double items_per_second;
+};
+
+// Grow the iteration count until one run takes at least min_time
+Result run_benchmark(const std::string& name, double items_per_iteration, double min_time,
+                     const std::function<void(long long)>& body) {
+    long long iterations = 1;
+    for (;;) {
+        std::clock_t cpu_start = std::clock();
+        auto start = std::chrono::high_resolution_clock::now();
+        body(iterations);
+        auto end = std::chrono::high_resolution_clock::now();
+        std::clock_t cpu_end = std::clock();
+
+        double seconds = std::chrono::duration<double>(end - start).count();
+        if (seconds >= min_time || iterations >= (1LL << 40)) {
+            double cpu_seconds = static_cast<double>(cpu_end - cpu_start) / CLOCKS_PER_SEC;
+            return {name, iterations, seconds * 1e9 / iterations, cpu_seconds * 1e9 / iterations,
+                    items_per_iteration * iterations / seconds};
+        }
+        // Aim directly for min_time once a measurable time has elapsed
+        double scale = seconds > 1e-3 ? 1.4 * min_time / seconds : 10.0;
+        iterations = static_cast<long long>(std::ceil(iterations * std::min(scale, 10.0)));
+    }
+}
+
+class Runner {
+public:
+    explicit Runner(const Options& options) : options_(options) {}
+
+    void add(const std::string& name, double items_per_iteration, const std::function<void(long long)>& body) {
+        if (!options_.filter.empty() && name.find(options_.filter) == std::string::npos) {
+            return;
+        }
+        Result result = run_benchmark(name, items_per_iteration, options_.min_time, body);
+        std::cout << std::left << std::setw(36) << result.name << std::right
+                  << std::fixed << std::setprecision(1) << std::setw(16) << result.real_ns << " ns"
+                  << std::setw(16) << result.cpu_ns << " ns" << std::setw(14) << result.iterations
+                  << std::setprecision(2) << std::setw(14) << 1e9 / result.items_per_second << " ns/item"
+                  << std::endl;
+        results_.push_back(result);
+    }
+
+    const std::vector<Result>& results() const { return results_; }
+
+private:
+    const Options& options_;
+    std::vector<Result> results_;
+};
+
+// Keeps results observable so the timed loops are not optimized away
+template<typename T>
+void do_not_optimize(const T& value) {
+    asm volatile("" : : "g"(&value) : "memory");
+}
+
+template<typename T>
+T test_value(std::size_t i) {
+    return T(1.0) + T(static_cast<double>(i % 97)) / T(97.0);
+}
+
+template<typename T>
+void bench_scalar(Runner& runner) {
+    using std::sqrt;
+    const std::string type = bailey::PrecisionTraits<T>::name();
+    constexpr std::size_t n = 1024;
+
+    std::vector<T> a(n), b(n), c(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        a[i] = test_value<T>(i);
+        b[i] = test_value<T>(i + 13);
+    }
+
+    auto elementwise = [&](const std::string& op, auto f) {
+        runner.add("BM_" + op + "<" + type + ">", static_cast<double>(n), [&](long long iterations) {
+            for (long long it = 0; it < iterations; ++it) {
+                for (std::size_t i = 0; i < n; ++i) {
+                    c[i] = f(a[i], b[i]);
+                }
+                do_not_optimize(c);
+            }
+        });
+    };
+    elementwise("add", [](const T& x, const T& y) { return x + y; });
+    elementwise("mul", [](const T& x, const T& y) { return x * y; });
+    elementwise("div", [](const T& x, const T& y) { return x / y; });
+    elementwise("sqrt", [](const T& x, const T&) { return sqrt(x); });
+}
+
+template<typename T>
+void bench_vector(Runner& runner, const Options& options) {
+    using VectorType = typename bailey::PrecisionTraits<T>::vector_type;
+    const std::string type = bailey::PrecisionTraits<T>::name();
+
+    for (std::size_t n : options.sizes) {
+        VectorType x(n), y(n);
+        for (std::size_t i = 0; i < n; ++i) {
+            x[i] = test_value<T>(i);
+            y[i] = test_value<T>(i + 13);
+        }
+        const std::string size = "/" + std::to_string(n);
+
+        runner.add("BM_dot<" + type + ">" + size, static_cast<double>(n), [&](long long iterations) {
+            for (long long it = 0; it < iterations; ++it) {
+                T result = algorithms::kernels::dot<T>(x, y);
+                do_not_optimize(result);
+            }
+        });
+
+        // Alternating sign keeps y bounded over many iterations
+        const T alpha = T(1.0e-3);
+        const T minus_alpha = T(-1.0e-3);
+        runner.add("BM_axpy<" + type + ">" + size, static_cast<double>(n), [&](long long iterations) {
+            for (long long it = 0; it < iterations; ++it) {
+                algorithms::kernels::axpy<T>(it % 2 == 0 ? alpha : minus_alpha, x, y);
+                do_not_optimize(y);
+            }
+        });
+    }
+}
+
+template<typename T>
+void bench_spmv(Runner& runner, const Options& options) {
+    using VectorType = typename bailey::PrecisionTraits<T>::vector_type;
+    const std::string type = bailey::PrecisionTraits<T>::name();
+
+    for (const std::string& name : options.matrices) {
+        const std::string case_name = "BM_spmv<" + type + ">/" + name;
+        if (!options.filter.empty() && case_name.find(options.filter) == std::string::npos) {
+            continue;
+        }
+        // Parse the .mtx every run: the benchmark must not write .csrbin caches into the inputs
+        const auto A = io::loadMatrixMarket<T>(io::constructMatrixPath(name, options.input_dir),
+                                               false);
+        VectorType p(A.cols()), w(A.rows());
+        for (Eigen::Index i = 0; i < A.cols(); ++i) {
+            p[i] = test_value<T>(i);
+        }
+
+        runner.add(case_name, static_cast<double>(A.nonZeros()), [&](long long iterations) {
+            for (long long it = 0; it < iterations; ++it) {
+                algorithms::kernels::spmv<T>(A, p, w);
+                do_not_optimize(w);
+            }
+        });
+    }
+}
+
+template<typename T>
+void bench_all(Runner& runner, const Options& options) {
+    bench_scalar<T>(runner);
+    bench_vector<T>(runner, options);
+    bench_spmv<T>(runner, options);
+}
+
+std::string json_escape(const std::string& s) {
+    std::string out;
+    for (char c : s) {
+        if (c == '"' || c == '\\') {
+            out += '\\';
+        }
+        out += c;
+    }
+    return out;
+}
+
+void write_json(const std::string& filename, const std::vector<Result>& results) {
+    std::ofstream file(filename);
+    if (!file) {
+        throw std::runtime_error("Cannot write " + filename);
+    }
+    std::time_t now = std::time(nullptr);
+    char date[64];
+    std::strftime(date, sizeof(date), "%Y-%m-%dT%H:%M:%S%z", std::localtime(&now));
+    int threads = 1;
+#ifdef _OPENMP
+    threads = omp_get_max_threads();
+#endif
+
+    file << "{\n  \"context\": {\n"
+         << "    \"date\": \"" << date << "\",\n"
+         << "    \"executable\": \"bench_kernels\",\n"
+         << "    \"num_threads\": " << threads << ",\n"
+#ifdef BAILEY_DD_INLINE
+         << "    \"dd_inline\": true,\n"
+#else
+         << "    \"dd_inline\": false,\n"
+#endif
+#ifdef BAILEY_DD_SOA
+         << "    \"dd_soa\": true,\n"
+#else
+         << "    \"dd_soa\": false,\n"
+#endif
+#ifdef NDEBUG
+         << "    \"library_build_type\": \"release\"\n"
+#else
+         << "    \"library_build_type\": \"debug\"\n"
+#endif
+         << "  },\n  \"benchmarks\": [";
+    file << std::setprecision(10);
+    for (std::size_t i = 0; i < results.size(); ++i) {
+        const Result& r = results[i];
+        file << (i == 0 ? "\n" : ",\n")
+             << "    {\n"
+             << "      \"name\": \"" << json_escape(r.name) << "\",\n"
+             << "      \"run_name\": \"" << json_escape(r.name) << "\",\n"
+             << "      \"run_type\": \"iteration\",\n"
+             << "      \"iterations\": " << r.iterations << ",\n"
+             << "      \"real_time\": " << r.real_ns << ",\n"
+             << "      \"cpu_time\": " << r.cpu_ns << ",\n"
+             << "      \"time_unit\": \"ns\",\n"
+             << "      \"items_per_second\": " << r.items_per_second << ",\n"
+             << "      \"ns_per_item\": " << 1e9 / r.items_per_second << "\n"
+             << "    }";
+    }
+    file << "\n  ]\n}\n";
+}
+
+std::vector<std::string> split(const std::string& list) {
+    std::vector<std::string> items;
+    std::stringstream stream(list);
+    for (std::string item; std::getline(stream, item, ',');) {
+        if (!item.empty()) {
+            items.push_back(item);
+        }
+    }
+    return items;
+}
+
+void print_usage(const char* program_name) {
+    std::cout << "\nUsage: " << program_name << " [OPTIONS]\n\n";
+    std::cout << "Options:\n";
+    std::cout << "  --json FILE           Also write results as Google Benchmark JSON\n";
+    std::cout << "  --filter TEXT         Only run benchmarks whose name contains TEXT (e.g. \"<DD>\", BM_spmv)\n";
+    std::cout << "  --min-time SECONDS    Minimum measured time per benchmark (default: 0.2)\n";
+    std::cout << "  --sizes N,N,...       Vector lengths for dot/axpy (default: 1024,65536,1048576)\n";
+    std::cout << "  --matrices A,B,...    Matrices for spmv (default: nos5,bcsstk13,LF10000)\n";
+    std::cout << "  --input-dir PATH      Matrix directory (default: inputs)\n";
+    std::cout << "  --help, -h            Show this help message\n\n";
+}
+
+Options parse_options(int argc, char* argv[]) {
+    Options options;
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "--json" && i + 1 < argc) {
+            options.json_file = argv[++i];
+        }
+        else if (arg == "--filter" && i + 1 < argc) {
+            options.filter = argv[++i];
+        }
+        else if (arg == "--min-time" && i + 1 < argc) {
+            try {
+                options.min_time = std::stod(argv[++i]);
+            } catch (...) {
+                throw std::runtime_error("Invalid min-time value");
+            }
+        }
+        else if (arg == "--sizes" && i + 1 < argc) {
+            options.sizes.clear();
+            for (const std::string& size : split(argv[++i])) {
+                try {
+                    options.sizes.push_back(std::stoul(size));
+                } catch (...) {
+                    throw std::runtime_error("Invalid size: " + size);
+                }
+            }
+        }
+        else if (arg == "--matrices" && i + 1 < argc) {
+            options.matrices = split(argv[++i]);
+        }
+        else if (arg == "--input-dir" && i + 1 < argc) {
+            options.input_dir = argv[++i];
+        }
+        else if (arg == "--help" || arg == "-h") {
+            throw std::runtime_error("help");
+        }
+        else {
+            throw std::runtime_error("Unknown argument: " + arg);
+        }
+    }
+    return options;
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    try {
+        Options options = parse_options(argc, argv);
+        std::erase_if(options.matrices, [&](const std::string& name) {
+            const std::string path = io::constructMatrixPath(name, options.input_dir);
+            if (std::filesystem::exists(path)) {
+                return false;
+            }
+            std::cerr << "Skipping " << name << ": " << path << " not found" << std::endl;
+            return true;
+        });
+        Runner runner(options);
+
+        std::cout << std::left << std::setw(36) << "Benchmark" << std::right
+                  << std::setw(19) << "Time" << std::setw(19) << "CPU"
+                  << std::setw(14) << "Iterations" << std::setw(22) << "Per item" << std::endl;
+        std::cout << std::string(110, '-') << std::endl;
+
+        bench_all<double>(runner, options);
+        bench_all<bailey::DDNumber>(runner, options);
+        bench_all<bailey::DQNumber>(runner, options);
+        bench_all<bailey::QXNumber>(runner, options);
+
+        if (!options.json_file.empty()) {
+            write_json(options.json_file, runner.results());
+            std::cout << "\nWrote " << runner.results().size() << " results to " << options.json_file << std::endl;
+        }
+    } catch (const std::exception& e) {
+        if (std::string(e.what()) == "help") {
+            print_usage(argv[0]);
+            return 0;
+        }
+        std::cerr << "Error: " << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,115 @@
+#include "bailey/precision_traits.hpp"
+#include "bailey/bailey_blas.hpp"
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <cstring>
+#include <vector>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+// Deterministic dot product benchmark: thread scaling of bailey_blas::dot
+// against the former serial loop, and a bitwise check that every thread
+// count produces the same result.
+
+namespace {
+
+template<typename T>
+T serial_dot(const std::vector<T>& x, const std::vector<T>& y) {
+    T result = T(0.0);
+    for (size_t i = 0; i < x.size(); ++i) {
+        result = result + x[i] * y[i];
+    }
+    return result;
+}
+
+template<typename F>
+double time_ms(int reps, F f) {
+    auto start = std::chrono::high_resolution_clock::now();
+    for (int r = 0; r < reps; ++r) {
+        f();
+    }
+    auto end = std::chrono::high_resolution_clock::now();
+    return std::chrono::duration<double, std::milli>(end - start).count() / reps;
+}
+
+int max_threads() {
+#ifdef _OPENMP
+    return omp_get_max_threads();
+#else
+    return 1;
+#endif
+}
+
+void set_threads(int n) {
+#ifdef _OPENMP
+    omp_set_num_threads(n);
+#else
+    (void)n;
+#endif
+}
+
+template<typename T>
+void bench(size_t n, int reps) {
+    using Traits = bailey::PrecisionTraits<T>;
+
+    std::vector<T> x(n), y(n);
+    for (size_t i = 0; i < n; ++i) {
+        x[i] = T(1.0) / T(static_cast<double>(i + 1));
+        y[i] = T(static_cast<double>(i % 7) - 3.0) / T(3.0);
+    }
+
+    T sink = T(0.0);
+    double t_serial = time_ms(reps, [&] { sink = serial_dot(x, y); });
+
+    std::cout << Traits::name() << " (n = " << n << ")" << std::endl;
+    std::cout << "  serial loop   : " << std::fixed << std::setprecision(3)
+              << std::setw(10) << t_serial << " ms" << std::endl;
+
+    const int threads_max = max_threads();
+    T reference = T(0.0);
+    bool reproducible = true;
+
+    for (int threads = 1; threads <= threads_max; threads *= 2) {
+        set_threads(threads);
+        T result = T(0.0);
+        double t = time_ms(reps, [&] { result = bailey_blas::dot(x, y); });
+
+        if (threads == 1) {
+            reference = result;
+        } else if (std::memcmp(&reference, &result, sizeof(T)) != 0) {
+            reproducible = false;
+        }
+
+        std::cout << "  reduce " << std::setw(3) << threads << " thr: "
+                  << std::setw(10) << t << " ms  (speedup vs serial "
+                  << std::setprecision(2) << t_serial / t << "x)"
+                  << std::setprecision(3) << std::endl;
+
+        if (threads < threads_max && threads * 2 > threads_max) {
+            threads = threads_max / 2;  // make sure threads_max itself is measured
+        }
+    }
+    set_threads(threads_max);
+
+    std::cout << "  bitwise identical across thread counts: "
+              << (reproducible ? "yes" : "NO") << std::endl;
+    std::cout << "  |serial - reduce| = " << std::scientific << std::setprecision(2)
+              << std::abs(to_double(sink) - to_double(reference)) << std::endl;
+}
+
+} // namespace
+
+int main() {
+    std::cout << "=== Deterministic parallel dot product (max threads: "
+              << max_threads() << ") ===" << std::endl;
+
+    bench<double>(1 << 22, 20);
+    bench<bailey::DDNumber>(1 << 20, 5);
+    bench<bailey::DQNumber>(1 << 18, 3);
+    bench<bailey::QXNumber>(1 << 18, 3);
+
+    return 0;
+}
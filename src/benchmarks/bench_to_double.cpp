@@ -0,0 +1,74 @@
+#include "bailey/precision_traits.hpp"
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <string>
+#include <vector>
+
+// to_double microbenchmark: direct limb conversion vs the former
+// string round-trip (to_string + std::stod) used for history recording.
+
+namespace {
+
+template<typename T>
+double string_round_trip(const T& a) {
+    return std::stod(to_string(a));
+}
+
+template<typename T, typename Convert>
+double time_ns_per_op(const std::vector<T>& values, int reps, Convert convert, double& sink) {
+    auto start = std::chrono::high_resolution_clock::now();
+    for (int r = 0; r < reps; ++r) {
+        for (const T& v : values) {
+            sink += convert(v);
+        }
+    }
+    auto end = std::chrono::high_resolution_clock::now();
+    double ns = std::chrono::duration<double, std::nano>(end - start).count();
+    return ns / (static_cast<double>(values.size()) * reps);
+}
+
+template<typename T>
+void bench(int n, int reps) {
+    using Traits = bailey::PrecisionTraits<T>;
+
+    // Residual-like values: 1/3 scaled over a wide exponent range
+    std::vector<T> values;
+    values.reserve(n);
+    for (int i = 0; i < n; ++i) {
+        values.push_back(T(1.0) / T(3.0) * T(std::ldexp(1.0, -(i % 60))));
+    }
+
+    double sink = 0.0;
+    int differing = 0;
+    for (const T& v : values) {
+        if (to_double(v) != string_round_trip(v)) {
+            ++differing;
+        }
+    }
+
+    double t_string = time_ns_per_op(values, reps, [](const T& v) { return string_round_trip(v); }, sink);
+    double t_direct = time_ns_per_op(values, reps * 100, [](const T& v) { return to_double(v); }, sink);
+
+    std::cout << std::left << std::setw(4) << Traits::name()
+              << std::right << std::fixed << std::setprecision(1)
+              << "  string: " << std::setw(9) << t_string << " ns/op"
+              << "  direct: " << std::setw(7) << t_direct << " ns/op"
+              << "  speedup: " << std::setw(8) << t_string / t_direct << "x"
+              << "  differing: " << differing << "/" << n
+              << "  (sink " << std::scientific << std::setprecision(1) << sink << ")" << std::endl;
+}
+
+} // namespace
+
+int main() {
+    const int n = 10000;
+    const int reps = 5;
+
+    std::cout << "=== to_double: direct conversion vs string round-trip ===" << std::endl;
+    bench<bailey::DDNumber>(n, reps);
+    bench<bailey::DQNumber>(n, reps);
+    bench<bailey::QXNumber>(n, reps);
+
+    return 0;
+}
@@ -0,0 +1,111 @@
+#include "bailey/precision_traits.hpp"
+#include "algorithms/conjugate_gradient.hpp"
+
+#include <iostream>
+#include <iomanip>
+#include <atomic>
+#include <cstdlib>
+#include <new>
+#include <vector>
+
+// Verify that steady-state CG iterations perform zero heap allocations.
+//
+// Global operator new is replaced by a counting version. The solver is run
+// with tolerance 0 (never converges) for two different iteration counts on
+// the same workspace; equal allocation counts mean the per-iteration cost
+// is zero allocations.
+
+namespace {
+std::atomic<long> g_allocations{0};
+}
+
+void* operator new(std::size_t size) {
+    g_allocations.fetch_add(1, std::memory_order_relaxed);
+    if (void* ptr = std::malloc(size == 0 ? 1 : size)) {
+        return ptr;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void* ptr) noexcept {
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept {
+    std::free(ptr);
+}
+
+namespace {
+
+/// 1D Laplacian tridiag(-1, 2, -1): SPD, slow enough to converge for the check
+template<typename T>
+typename bailey::PrecisionTraits<T>::matrix_type laplacian(int n) {
+    std::vector<Eigen::Triplet<T>> triplets;
+    for (int i = 0; i < n; ++i) {
+        triplets.emplace_back(i, i, T(2.0));
+        if (i > 0) triplets.emplace_back(i, i - 1, T(-1.0));
+        if (i + 1 < n) triplets.emplace_back(i, i + 1, T(-1.0));
+    }
+    typename bailey::PrecisionTraits<T>::matrix_type A(n, n);
+    A.setFromTriplets(triplets.begin(), triplets.end());
+    return A;
+}
+
+template<typename T>
+long count_allocations(const typename bailey::PrecisionTraits<T>::matrix_type& A,
+                       const typename bailey::PrecisionTraits<T>::vector_type& b,
+                       const typename bailey::PrecisionTraits<T>::vector_type& x_true,
+                       algorithms::CGWorkspace<T>& ws,
+                       int iterations) {
+    using VectorType = typename bailey::PrecisionTraits<T>::vector_type;
+    VectorType x = VectorType::Zero(A.rows());
+
+    long before = g_allocations.load();
+    auto result = algorithms::conjugateGradient<T>(A, b, x, x_true, iterations, 0.0, ws);
+    long after = g_allocations.load();
+
+    if (result.iterations_performed != iterations) {
+        std::cerr << "unexpected iteration count " << result.iterations_performed << std::endl;
+        return -1;
+    }
+    return after - before;
+}
+
+template<typename T>
+bool check() {
+    using Traits = bailey::PrecisionTraits<T>;
+    using VectorType = typename Traits::vector_type;
+
+    const int n = 200;
+    auto A = laplacian<T>(n);
+    VectorType x_true = VectorType::Ones(n);
+    VectorType b(n);
+    algorithms::kernels::spmv<T>(A, x_true, b);
+
+    algorithms::CGWorkspace<T> ws;
+    ws.resize(n);
+
+    long short_run = count_allocations<T>(A, b, x_true, ws, 5);
+    long long_run = count_allocations<T>(A, b, x_true, ws, 50);
+    bool ok = short_run >= 0 && short_run == long_run;
+
+    std::cout << std::left << std::setw(7) << Traits::name()
+              << "allocations: 5 iter = " << short_run
+              << ", 50 iter = " << long_run
+              << (ok ? "  [OK]" : "  [FAIL]") << std::endl;
+    return ok;
+}
+
+} // namespace
+
+int main() {
+    std::cout << "=== CG steady-state allocation check ===" << std::endl;
+
+    bool ok = true;
+    ok &= check<double>();
+    ok &= check<bailey::DDNumber>();
+    ok &= check<bailey::DQNumber>();
+    ok &= check<bailey::QXNumber>();
+
+    return ok ? 0 : 1;
+}
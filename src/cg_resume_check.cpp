@@ -0,0 +1,146 @@
+#include "bailey/precision_traits.hpp"
+#include "algorithms/conjugate_gradient.hpp"
+#include "io/cg_checkpoint.hpp"
+
+#include <iostream>
+#include <iomanip>
+#include <filesystem>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+// Verify that a CG solve resumed from a checkpoint continues bit-identically.
+//
+// A solve is interrupted after a few checkpoints (written by
+// io::CheckpointWriter), read back and resumed to the full iteration count;
+// x and every history entry must equal those of an uninterrupted solve.
+// Resuming with different diagnostics settings must be rejected.
+
+namespace {
+
+/// 1D Laplacian tridiag(-1, 2, -1): SPD, slow enough to converge for the check
+template<typename T>
+typename bailey::PrecisionTraits<T>::matrix_type laplacian(int n) {
+    std::vector<Eigen::Triplet<T>> triplets;
+    for (int i = 0; i < n; ++i) {
+        triplets.emplace_back(i, i, T(2.0));
+        if (i > 0) triplets.emplace_back(i, i - 1, T(-1.0));
+        if (i + 1 < n) triplets.emplace_back(i, i + 1, T(-1.0));
+    }
+    typename bailey::PrecisionTraits<T>::matrix_type A(n, n);
+    A.setFromTriplets(triplets.begin(), triplets.end());
+    return A;
+}
+
+// Bitwise equality of the limbs (QXNumber::operator== compares with a tolerance)
+bool same(double a, double b) { return a == b; }
+bool same(const bailey::DDNumber& a, const bailey::DDNumber& b) { return a.dd[0] == b.dd[0] && a.dd[1] == b.dd[1]; }
+bool same(const bailey::DQNumber& a, const bailey::DQNumber& b) { return a.dq[0] == b.dq[0] && a.dq[1] == b.dq[1]; }
+bool same(const bailey::QXNumber& a, const bailey::QXNumber& b) { return a.qx == b.qx; }
+
+template<typename T, typename VectorType>
+bool same_vector(const VectorType& a, const VectorType& b) {
+    if (a.size() != b.size()) {
+        return false;
+    }
+    for (Eigen::Index i = 0; i < a.size(); ++i) {
+        T ai = a[i];
+        T bi = b[i];
+        if (!same(ai, bi)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+template<typename T>
+bool same_history(const algorithms::CGResult<T>& a, const algorithms::CGResult<T>& b) {
+    return a.iterations_performed == b.iterations_performed &&
+           a.hist_relres_2 == b.hist_relres_2 &&
+           a.hist_relerr_2 == b.hist_relerr_2 &&
+           a.hist_relerr_A == b.hist_relerr_A &&
+           a.hist_relerr_iter == b.hist_relerr_iter &&
+           a.history_entries == b.history_entries &&
+           a.final_residual_norm == b.final_residual_norm;
+}
+
+template<typename T>
+bool check() {
+    using Traits = bailey::PrecisionTraits<T>;
+    using VectorType = typename Traits::vector_type;
+
+    const int n = 200;
+    const int max_iter = 60;
+    const int interrupt_iter = 30;
+    auto A = laplacian<T>(n);
+    VectorType x_true = VectorType::Ones(n);
+    VectorType b(n);
+    algorithms::kernels::spmv<T>(A, x_true, b);
+
+    algorithms::DiagnosticsPolicy diagnostics;
+    diagnostics.mode = algorithms::DiagnosticsMode::Full;
+    diagnostics.interval = 4;
+    algorithms::CGWorkspace<T> ws;
+
+    // Uninterrupted reference (tolerance 0: runs all max_iter iterations)
+    VectorType x_ref = VectorType::Zero(n);
+    auto reference = algorithms::conjugateGradient<T>(A, b, x_ref, x_true, max_iter, 0.0, ws, diagnostics);
+
+    // Interrupted run: checkpoints at 7, 14, 21, 28
+    const std::string path = (std::filesystem::temp_directory_path() /
+                              ("cg_resume_check_" + std::string(Traits::key()) + ".ckpt")).string();
+    int written_iteration = -1;
+    {
+        io::CheckpointWriter<T> writer(path, b);
+        algorithms::CheckpointPolicy<T> checkpoint;
+        checkpoint.sink = &writer;
+        checkpoint.interval = 7;
+        VectorType x = VectorType::Zero(n);
+        algorithms::conjugateGradient<T>(A, b, x, x_true, interrupt_iter, 0.0, ws, diagnostics, checkpoint);
+        writer.close();
+        written_iteration = writer.last_iteration();
+    }
+
+    // Resume to max_iter
+    auto state = io::readCheckpoint<T>(path, b);
+    std::filesystem::remove(path);
+    algorithms::CheckpointPolicy<T> resume;
+    resume.resume = &state;
+    VectorType x = VectorType::Zero(n);
+    auto resumed = algorithms::conjugateGradient<T>(A, b, x, x_true, max_iter, 0.0, ws, diagnostics, resume);
+
+    bool identical = written_iteration == 28 && same_vector<T>(x, x_ref) && same_history(resumed, reference);
+
+    // Resuming with other diagnostics settings must throw (also with NDEBUG)
+    bool rejected = false;
+    try {
+        algorithms::DiagnosticsPolicy residual_only;
+        residual_only.mode = algorithms::DiagnosticsMode::Residual;
+        VectorType x_other = VectorType::Zero(n);
+        algorithms::conjugateGradient<T>(A, b, x_other, x_true, max_iter, 0.0, ws, residual_only, resume);
+    } catch (const std::runtime_error&) {
+        rejected = true;
+    }
+
+    bool ok = identical && rejected;
+    std::cout << std::left << std::setw(7) << Traits::name()
+              << "resume at " << written_iteration << ": "
+              << (identical ? "bit-identical" : "DIFFERS")
+              << ", mismatched diagnostics " << (rejected ? "rejected" : "ACCEPTED")
+              << (ok ? "  [OK]" : "  [FAIL]") << std::endl;
+    return ok;
+}
+
+} // namespace
+
+int main() {
+    std::cout << "=== CG checkpoint/resume check ===" << std::endl;
+
+    bool ok = true;
+    ok &= check<double>();
+    ok &= check<bailey::DDNumber>();
+    ok &= check<bailey::DQNumber>();
+    ok &= check<bailey::QXNumber>();
+
+    return ok ? 0 : 1;
+}
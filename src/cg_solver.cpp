@@ -1,9 +1,18 @@
 #include "bailey/precision_traits.hpp"
+#include "bailey/precision_registry.hpp"
 #include "bailey/dd_arithmetic.hpp"
 #include "bailey/dq_arithmetic.hpp"
 #include "bailey/qx_arithmetic.hpp"
 #include "algorithms/conjugate_gradient.hpp"
+#include "algorithms/iterative_refinement.hpp"
+#include "algorithms/preconditioned_cg.hpp"
+#include "algorithms/pipelined_cg.hpp"
+#include "algorithms/sstep_cg.hpp"
+#include "algorithms/multi_rhs_cg.hpp"
+#include "algorithms/cg_instantiations.hpp"
 #include "io/matrix_market.hpp"
+#include "io/history_stream.hpp"
+#include "io/cg_checkpoint.hpp"
 #ifdef ENABLE_MAT_EXPORT
 #include "io/mat_exporter.hpp"
 #endif
@@ -15,20 +24,121 @@
 #include <sstream>
 #include <algorithm>
 #include <filesystem>
+#include <chrono>
+#include <type_traits>
+#include <random>
+#include <fstream>
+#include <map>
+#include <memory>
+#include <optional>
+#include <mutex>
+#include <thread>
+#include <atomic>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
 
 // Command line configuration
 struct SolverConfig {
     std::string matrix_name;
-    std::string precision_level{"qx"};  // dd, dq, qx
+    std::string precision_level{"qx"};  // dd, dq, qx, double, dd-ir, dq-ir, qx-ir
     double tolerance{1.0e-12};
     std::variant<int, double> max_iter{2.0};  // Default: 2*n
     std::string input_dir{"/work/inputs"};
     std::string export_mat_file;  // Empty if not specified
+    std::string history_stream_file;  // Stream convergence history to this CSV (empty: keep in memory)
+    std::string checkpoint_file;  // Write CG checkpoints here (empty: none)
+    int checkpoint_interval{1000};  // Iterations between checkpoints
+    std::string resume_file;  // Continue from this checkpoint (empty: start from x = 0)
+    bool use_matrix_cache{true};  // Binary CSR cache next to the .mtx
+    std::string matrix_storage{"full"};  // full, symmetric (upper triangle only)
+    std::string matrix_values{"native"};  // native (solver precision), double (promoted in SpMV)
+    algorithms::DiagnosticsPolicy diagnostics;  // Default: full history every iteration
+    std::string inner_precision{"double"};  // Inner CG precision for *-ir modes: double, dd
+    algorithms::RefinementParameters refinement;
+    std::string algorithm{"classic"};  // classic, pipelined, sstep
+    int sstep{4};  // Iterations per outer step for --algorithm sstep
+    int nrhs{1};  // Number of right-hand sides (multi-RHS CG if > 1)
+    std::string batch_file;  // Job list for --batch (empty: single solve)
+    int batch_workers{0};  // Concurrent batch jobs (0: one per hardware thread)
+    algorithms::PreconditionerType preconditioner{algorithms::PreconditionerType::None};
+    double ssor_omega{1.0};  // SSOR relaxation factor
 };
 
+// Precisions selectable on the command line (see bailey/precision_registry.hpp)
+using SolverPrecisions = bailey::AllPrecisions;  // --precision <key>
+using RefinedPrecisions = bailey::PrecisionList<bailey::DDNumber, bailey::DQNumber, bailey::QXNumber>;  // --precision <key>-ir
+using InnerPrecisions = bailey::PrecisionList<double, bailey::DDNumber>;  // --inner-precision
+
+// Suffix of iterative refinement precision levels (outer precision key + "-ir")
+constexpr std::string_view refinement_suffix = "-ir";
+
+// All valid --precision values, for help and error messages
+std::string precisionLevels() {
+    return SolverPrecisions::join() + ", " + RefinedPrecisions::join(refinement_suffix);
+}
+
+// Precision level check shared by --precision and batch job files
+void validatePrecisionLevel(const std::string& level) {
+    std::string_view key = level;
+    const bool refined = key.ends_with(refinement_suffix);
+    if (refined) {
+        key.remove_suffix(refinement_suffix.size());
+    }
+    if (!(refined ? RefinedPrecisions::contains(key) : SolverPrecisions::contains(key))) {
+        throw std::runtime_error("Invalid precision level. Use: " + precisionLevels());
+    }
+}
+
+// Absolute count ("1000") or coefficient of n ("2.0")
+std::variant<int, double> parseMaxIter(const std::string& value) {
+    try {
+        if (value.find('.') != std::string::npos) {
+            return std::stod(value);
+        }
+        return std::stoi(value);
+    } catch (...) {
+        throw std::runtime_error("Invalid max-iter value");
+    }
+}
+
+// Combinations of options that no solver supports
+void validateConfig(const SolverConfig& config) {
+    if (config.preconditioner != algorithms::PreconditionerType::None &&
+        config.precision_level.ends_with("-ir")) {
+        throw std::runtime_error("--precond is not supported with iterative refinement (*-ir)");
+    }
+    if (config.algorithm != "classic") {
+        if (config.precision_level.ends_with("-ir")) {
+            throw std::runtime_error("--algorithm " + config.algorithm + " is not supported with iterative refinement (*-ir)");
+        }
+        if (config.preconditioner != algorithms::PreconditionerType::None) {
+            throw std::runtime_error("--algorithm " + config.algorithm + " does not support --precond");
+        }
+    }
+    if (!config.checkpoint_file.empty() || !config.resume_file.empty()) {
+        if (config.precision_level.ends_with("-ir") || config.algorithm != "classic" ||
+            config.preconditioner != algorithms::PreconditionerType::None || config.nrhs > 1) {
+            throw std::runtime_error("--checkpoint/--resume require --algorithm classic without --precond, --nrhs or *-ir");
+        }
+    }
+    if (config.nrhs > 1) {
+        if (!config.history_stream_file.empty()) {
+            throw std::runtime_error("--history-stream is not supported with --nrhs");
+        }
+        if (config.precision_level.ends_with("-ir")) {
+            throw std::runtime_error("--nrhs is not supported with iterative refinement (*-ir)");
+        }
+        if (config.preconditioner != algorithms::PreconditionerType::None || config.algorithm != "classic") {
+            throw std::runtime_error("--nrhs requires --algorithm classic without --precond");
+        }
+    }
+}
+
 // Command line parser
 SolverConfig parseCommandLine(int argc, char* argv[]) {
     SolverConfig config;
+    bool matrix_values_given = false;  // Batch mode rejects an explicit --matrix-values native
     
     for (int i = 1; i < argc; ++i) {
         std::string arg = argv[i];
@@ -38,12 +148,7 @@ SolverConfig parseCommandLine(int argc, char* argv[]) {
         }
         else if (arg == "--precision" && i + 1 < argc) {
             config.precision_level = argv[++i];
-            if (config.precision_level != "dd" && 
-                config.precision_level != "dq" && 
-                config.precision_level != "qx" &&
-                config.precision_level != "double") {
-                throw std::runtime_error("Invalid precision level. Use: dd, dq, qx, or double");
-            }
+            validatePrecisionLevel(config.precision_level);
         }
         else if (arg == "--tol" && i + 1 < argc) {
             try {
@@ -53,16 +158,7 @@ SolverConfig parseCommandLine(int argc, char* argv[]) {
             }
         }
         else if (arg == "--max-iter" && i + 1 < argc) {
-            std::string value = argv[++i];
-            try {
-                if (value.find('.') != std::string::npos) {
-                    config.max_iter = std::stod(value);
-                } else {
-                    config.max_iter = std::stoi(value);
-                }
-            } catch (...) {
-                throw std::runtime_error("Invalid max-iter value");
-            }
+            config.max_iter = parseMaxIter(argv[++i]);
         }
         else if (arg == "--input-dir" && i + 1 < argc) {
             config.input_dir = argv[++i];
@@ -70,6 +166,130 @@ SolverConfig parseCommandLine(int argc, char* argv[]) {
         else if (arg == "--export-mat" && i + 1 < argc) {
             config.export_mat_file = argv[++i];
         }
+        else if (arg == "--history-stream" && i + 1 < argc) {
+            config.history_stream_file = argv[++i];
+        }
+        else if (arg == "--checkpoint" && i + 1 < argc) {
+            config.checkpoint_file = argv[++i];
+        }
+        else if (arg == "--checkpoint-every" && i + 1 < argc) {
+            try {
+                config.checkpoint_interval = std::stoi(argv[++i]);
+            } catch (...) {
+                throw std::runtime_error("Invalid checkpoint-every value");
+            }
+            if (config.checkpoint_interval < 1) {
+                throw std::runtime_error("Invalid checkpoint-every value (must be >= 1)");
+            }
+        }
+        else if (arg == "--resume" && i + 1 < argc) {
+            config.resume_file = argv[++i];
+        }
+        else if (arg == "--storage" && i + 1 < argc) {
+            config.matrix_storage = argv[++i];
+            if (config.matrix_storage != "full" && config.matrix_storage != "symmetric") {
+                throw std::runtime_error("Invalid storage. Use: full or symmetric");
+            }
+        }
+        else if (arg == "--matrix-values" && i + 1 < argc) {
+            config.matrix_values = argv[++i];
+            if (config.matrix_values != "native" && config.matrix_values != "double") {
+                throw std::runtime_error("Invalid matrix values. Use: native or double");
+            }
+            matrix_values_given = true;
+        }
+        else if (arg == "--no-cache") {
+            config.use_matrix_cache = false;
+        }
+        else if (arg == "--diagnostics" && i + 1 < argc) {
+            config.diagnostics.mode = algorithms::parse_diagnostics_mode(argv[++i]);
+        }
+        else if (arg == "--diag-every" && i + 1 < argc) {
+            try {
+                config.diagnostics.interval = std::stoi(argv[++i]);
+            } catch (...) {
+                throw std::runtime_error("Invalid diag-every value");
+            }
+            if (config.diagnostics.interval < 1) {
+                throw std::runtime_error("Invalid diag-every value (must be >= 1)");
+            }
+        }
+        else if (arg == "--inner-precision" && i + 1 < argc) {
+            config.inner_precision = argv[++i];
+            if (!InnerPrecisions::contains(config.inner_precision)) {
+                throw std::runtime_error("Invalid inner precision. Use: " + InnerPrecisions::join());
+            }
+        }
+        else if (arg == "--inner-tol" && i + 1 < argc) {
+            try {
+                config.refinement.inner_tolerance = std::stod(argv[++i]);
+            } catch (...) {
+                throw std::runtime_error("Invalid inner-tol value");
+            }
+        }
+        else if (arg == "--max-outer" && i + 1 < argc) {
+            try {
+                config.refinement.max_outer = std::stoi(argv[++i]);
+            } catch (...) {
+                throw std::runtime_error("Invalid max-outer value");
+            }
+            if (config.refinement.max_outer < 1) {
+                throw std::runtime_error("Invalid max-outer value (must be >= 1)");
+            }
+        }
+        else if (arg == "--algorithm" && i + 1 < argc) {
+            config.algorithm = argv[++i];
+            if (config.algorithm != "classic" && config.algorithm != "pipelined" && config.algorithm != "sstep") {
+                throw std::runtime_error("Invalid algorithm. Use: classic, pipelined, or sstep");
+            }
+        }
+        else if (arg == "--s" && i + 1 < argc) {
+            try {
+                config.sstep = std::stoi(argv[++i]);
+            } catch (...) {
+                throw std::runtime_error("Invalid s value");
+            }
+            if (config.sstep < 1 || config.sstep > algorithms::max_sstep) {
+                throw std::runtime_error("Invalid s value (must be in [1, " + std::to_string(algorithms::max_sstep) + "])");
+            }
+        }
+        else if (arg == "--nrhs" && i + 1 < argc) {
+            try {
+                config.nrhs = std::stoi(argv[++i]);
+            } catch (...) {
+                throw std::runtime_error("Invalid nrhs value");
+            }
+            if (config.nrhs < 1 || config.nrhs > algorithms::kernels::max_block_columns) {
+                throw std::runtime_error("Invalid nrhs value (must be in [1, " +
+                                         std::to_string(algorithms::kernels::max_block_columns) + "])");
+            }
+        }
+        else if (arg == "--precond" && i + 1 < argc) {
+            config.preconditioner = algorithms::parse_preconditioner_type(argv[++i]);
+        }
+        else if (arg == "--ssor-omega" && i + 1 < argc) {
+            try {
+                config.ssor_omega = std::stod(argv[++i]);
+            } catch (...) {
+                throw std::runtime_error("Invalid ssor-omega value");
+            }
+            if (!(config.ssor_omega > 0.0 && config.ssor_omega < 2.0)) {
+                throw std::runtime_error("Invalid ssor-omega value (must be in (0, 2))");
+            }
+        }
+        else if (arg == "--batch" && i + 1 < argc) {
+            config.batch_file = argv[++i];
+        }
+        else if (arg == "--jobs" && i + 1 < argc) {
+            try {
+                config.batch_workers = std::stoi(argv[++i]);
+            } catch (...) {
+                throw std::runtime_error("Invalid jobs value");
+            }
+            if (config.batch_workers < 1) {
+                throw std::runtime_error("Invalid jobs value (must be >= 1)");
+            }
+        }
         else if (arg == "--help" || arg == "-h") {
             throw std::runtime_error("help");  // Special case for help
         }
@@ -78,9 +298,20 @@ SolverConfig parseCommandLine(int argc, char* argv[]) {
         }
     }
     
+    if (!config.batch_file.empty()) {
+        if (!config.history_stream_file.empty() || !config.checkpoint_file.empty() || !config.resume_file.empty()) {
+            throw std::runtime_error("--history-stream, --checkpoint and --resume are not supported with --batch");
+        }
+        if (matrix_values_given && config.matrix_values == "native") {
+            throw std::runtime_error("--matrix-values native is not supported with --batch "
+                                     "(jobs share one double-valued matrix)");
+        }
+        return config;  // Matrix, precision etc. come from the job file (validated per job)
+    }
     if (config.matrix_name.empty()) {
         throw std::runtime_error("Matrix name is required (--matrix)");
     }
+    validateConfig(config);
     
     return config;
 }
@@ -116,100 +347,632 @@ void printUsage(const char* program_name) {
     std::cout << "\nUsage: " << program_name << " [OPTIONS]\n\n";
     std::cout << "Options:\n";
     std::cout << "  --matrix NAME         Matrix name (required, e.g., nos5 for nos5.mtx)\n";
-    std::cout << "  --precision LEVEL     Precision level: dd, dq, qx, double (default: qx)\n";
+    std::cout << "  --precision LEVEL     Precision level: " << SolverPrecisions::join() << " (default: qx)\n";
+    std::cout << "                        - " << RefinedPrecisions::join(refinement_suffix) << ": iterative refinement, inner CG in\n";
+    std::cout << "                          --inner-precision, residual/update in the outer precision\n";
     std::cout << "  --tol VALUE           Convergence tolerance (default: 1.0e-12)\n";
     std::cout << "  --max-iter VALUE      Maximum iterations:\n";
     std::cout << "                        - Integer: absolute number of iterations\n";
     std::cout << "                        - Float: coefficient * matrix_size (default: 2.0)\n";
     std::cout << "  --input-dir PATH      Input directory path (default: /work/inputs)\n";
     std::cout << "  --export-mat FILE     Export convergence data to MATLAB .mat file\n";
+    std::cout << "  --history-stream FILE Write the convergence history to a CSV file while solving\n";
+    std::cout << "                        (flushed every second; the result keeps no history in memory)\n";
+    std::cout << "  --checkpoint FILE     Save the classic CG state to FILE while solving (written in the background)\n";
+    std::cout << "  --checkpoint-every K  Iterations between checkpoints (default: 1000)\n";
+    std::cout << "  --resume FILE         Continue a solve from a checkpoint (same matrix, precision and options)\n";
+    std::cout << "  --storage TYPE        Matrix storage: full, symmetric (upper triangle, default: full)\n";
+    std::cout << "  --matrix-values TYPE  Matrix value type: native (solver precision), double\n";
+    std::cout << "                        (kept as read from the .mtx, promoted in SpMV; default: native)\n";
+    std::cout << "  --no-cache            Always parse the .mtx (skip the binary CSR cache)\n";
+    std::cout << "  --diagnostics MODE    Convergence history: none, residual, full (default: full)\n";
+    std::cout << "                        - none/residual: one SpMV per iteration, x_true unused\n";
+    std::cout << "  --diag-every K        With full diagnostics, record error norms every K iterations (default: 1)\n";
+    std::cout << "  --inner-precision P   Inner CG precision for *-ir modes: " << InnerPrecisions::join() << " (default: double)\n";
+    std::cout << "  --inner-tol VALUE     Inner CG tolerance for *-ir modes (default: 1.0e-8)\n";
+    std::cout << "  --max-outer VALUE     Maximum refinement steps for *-ir modes (default: 50)\n";
+    std::cout << "  --algorithm NAME      CG variant: classic, pipelined (one reduction per iteration),\n";
+    std::cout << "                        sstep (one Gram reduction per s iterations; default: classic)\n";
+    std::cout << "  --s VALUE             Iterations per outer step for --algorithm sstep (default: 4)\n";
+    std::cout << "  --nrhs K              Solve K right-hand sides at once (multi-RHS CG with SpMM, default: 1)\n";
+    std::cout << "                        x_true(:,0) = ones, other columns pseudo-random in [-1, 1)\n";
+    std::cout << "  --batch FILE          Run the jobs listed in FILE, one per line:\n";
+    std::cout << "                        matrix precision [tol [max-iter [export.mat|-]]]\n";
+    std::cout << "                        (each matrix is loaded once with double values and shared, as with\n";
+    std::cout << "                        --matrix-values double; other options apply to all jobs)\n";
+    std::cout << "  --jobs N              Batch jobs run concurrently (default: one per hardware thread)\n";
+    std::cout << "  --precond TYPE        Preconditioner: none, jacobi, ssor, ic0 (default: none)\n";
+    std::cout << "  --ssor-omega VALUE    SSOR relaxation factor in (0, 2) (default: 1.0)\n";
     std::cout << "  --help, -h            Show this help message\n\n";
     std::cout << "Examples:\n";
     std::cout << "  " << program_name << " --matrix nos5 --precision qx --tol 1e-15\n";
     std::cout << "  " << program_name << " --matrix nos7 --precision dq --max-iter 1000\n";
     std::cout << "  " << program_name << " --matrix test --precision dd --max-iter 2.5\n";
     std::cout << "  " << program_name << " --matrix nos5 --precision double --tol 1e-10\n";
-    std::cout << "  " << program_name << " --matrix nos5 --precision dq --export-mat results.mat\n\n";
+    std::cout << "  " << program_name << " --matrix nos5 --precision dq --export-mat results.mat\n";
+    std::cout << "  " << program_name << " --matrix LF10000 --precision dq --diagnostics residual\n";
+    std::cout << "  " << program_name << " --matrix LF10000 --precision dq --history-stream LF10000_dq.csv\n";
+    std::cout << "  " << program_name << " --matrix LF10000 --precision dq --checkpoint LF10000_dq.ckpt --resume LF10000_dq.ckpt\n";
+    std::cout << "  " << program_name << " --matrix nos5 --precision dq-ir --tol 1e-30\n";
+    std::cout << "  " << program_name << " --matrix LF10000 --precision dq --matrix-values double\n";
+    std::cout << "  " << program_name << " --matrix ex10 --precision dd --precond ic0\n";
+    std::cout << "  " << program_name << " --matrix nos5 --precision dd --nrhs 8 --export-mat nos5_dd.mat\n";
+    std::cout << "  " << program_name << " --batch jobs.txt --jobs 4 --diagnostics residual\n\n";
 }
 
-// Template solver function
-template<typename T>
-int solveCG(const SolverConfig& config) {
-    using Traits = bailey::PrecisionTraits<T>;
-    using MatrixType = typename Traits::matrix_type;
-    using VectorType = typename Traits::vector_type;
-    
-    std::string matrix_path = io::constructMatrixPath(config.matrix_name, config.input_dir);
-    
-    std::cout << "Loading matrix: " << matrix_path << " (precision: " << Traits::name() << ")" << std::endl;
+// Bytes held by the matrix values and index arrays
+template<typename Scalar, int Options>
+std::size_t matrixBytes(const Eigen::SparseMatrix<Scalar, Options>& A) {
+    return A.nonZeros() * (sizeof(Scalar) + sizeof(int)) + (A.outerSize() + 1) * sizeof(int);
+}
+
+template<typename Scalar>
+std::size_t matrixBytes(const bailey::SymmetricCsrMatrix<Scalar>& A) {
+    return A.memoryBytes();
+}
+
+// Build the configured preconditioner, report its setup time and run PCG
+template<typename T, typename MatrixType>
+algorithms::CGResult<T> solvePreconditioned(const SolverConfig& config, const MatrixType& A,
+                                            const typename bailey::PrecisionTraits<T>::vector_type& b,
+                                            typename bailey::PrecisionTraits<T>::vector_type& x,
+                                            const typename bailey::PrecisionTraits<T>::vector_type& x_true,
+                                            int max_iterations, const algorithms::DiagnosticsPolicy& diagnostics,
+                                            std::ostream& out) {
+    auto run = [&](auto build) {
+        auto setup_start = std::chrono::high_resolution_clock::now();
+        const auto M = build();
+        auto setup_end = std::chrono::high_resolution_clock::now();
+        
+        out << "Preconditioner: " << M.name();
+        if constexpr (std::is_same_v<std::decay_t<decltype(M)>, algorithms::SSORPreconditioner<T>>) {
+            out << " (omega " << std::fixed << std::setprecision(2) << config.ssor_omega << ")";
+        }
+        if constexpr (std::is_same_v<std::decay_t<decltype(M)>, algorithms::IC0Preconditioner<T>>) {
+            if (M.shift() > 0.0) {
+                out << " (diagonal shift " << std::scientific << std::setprecision(1) << M.shift() << ")";
+            }
+        }
+        out << std::fixed << std::setprecision(3) << ", setup time[s]: "
+                  << std::chrono::duration<double>(setup_end - setup_start).count() << std::endl;
+        
+        out << "\nStarting PCG iterations...\n";
+        return algorithms::preconditionedConjugateGradient<T>(A, b, x, x_true, M, max_iterations,
+                                                              config.tolerance, diagnostics);
+    };
     
-    MatrixType A = io::loadMatrixMarket<T>(matrix_path);
+    switch (config.preconditioner) {
+        case algorithms::PreconditionerType::Jacobi:
+            return run([&] { return algorithms::JacobiPreconditioner<T>(A); });
+        case algorithms::PreconditionerType::SSOR:
+            return run([&] { return algorithms::SSORPreconditioner<T>(A, config.ssor_omega); });
+        case algorithms::PreconditionerType::IC0:
+            return run([&] { return algorithms::IC0Preconditioner<T>(A); });
+        default:
+            break;
+    }
+    throw std::runtime_error("No preconditioner selected");
+}
+
+// Serializes .mat writes of concurrent batch jobs (matio makes no thread-safety guarantees)
+std::mutex export_mutex;
+
+// Export one result to a MATLAB .mat file (warns if export is unavailable or fails)
+template<typename T>
+void exportResult(const SolverConfig& config, const algorithms::CGResult<T>& result, const std::string& filename,
+                  std::ostream& out) {
+#ifdef ENABLE_MAT_EXPORT
+    std::lock_guard<std::mutex> lock(export_mutex);
+    std::string export_path = resolveExportPath(filename);
+    out << "\nExporting convergence data to " << export_path << "..." << std::endl;
+    bool export_success = io::MatExporter::export_convergence_data(
+        result, 
+        export_path, 
+        config.matrix_name, 
+        config.precision_level
+    );
+    if (export_success) {
+        out << "Export successful." << std::endl;
+    } else {
+        std::cerr << "Warning: Export failed." << std::endl;
+    }
+#else
+    (void)config;
+    (void)result;
+    (void)filename;
+    (void)out;
+    std::cerr << "Warning: MATLAB export not available - built without matio-cpp support." << std::endl;
+#endif
+}
+
+// Solve nrhs right-hand sides with multi-RHS CG; results are printed and exported per RHS
+// (export file name gets a _rhs<j> suffix before the extension)
+template<typename T, typename MatrixType>
+int solveMultiRhs(const SolverConfig& config, const MatrixType& A, int max_iterations, std::ostream& out) {
+    using BlockType = typename bailey::PrecisionTraits<T>::block_type;
+    const Eigen::Index n = A.rows();
+    const Eigen::Index k = config.nrhs;
+
+    // x_true(:,0) = ones (same problem as a single-RHS run), further columns
+    // pseudo-random in [-1, 1) from a fixed seed (53 random bits per entry)
+    BlockType X_true(n, k);
+    std::mt19937_64 rng(20240521);
+    for (Eigen::Index i = 0; i < n; ++i) {
+        X_true(i, 0) = T(1.0);
+    }
+    for (Eigen::Index j = 1; j < k; ++j) {
+        for (Eigen::Index i = 0; i < n; ++i) {
+            X_true(i, j) = T(2.0 * static_cast<double>(rng() >> 11) * 0x1.0p-53 - 1.0);
+        }
+    }
+    BlockType B(n, k);
+    algorithms::kernels::spmm<T>(A, X_true, B);
+    BlockType X = BlockType::Zero(n, k);
+
+    out << "\nStarting multi-RHS CG iterations (" << k << " right-hand sides)...\n";
+    auto results = algorithms::multiRhsConjugateGradient<T, MatrixType>(A, B, X, X_true, max_iterations,
+                                                                         config.tolerance, config.diagnostics);
+
+    bool all_converged = true;
+    for (Eigen::Index j = 0; j < k; ++j) {
+        algorithms::print_results(results[j], config.matrix_name + ".mtx (rhs " + std::to_string(j) + ")", out);
+        all_converged = all_converged && results[j].converged;
+    }
+
+    if (!config.export_mat_file.empty()) {
+        std::filesystem::path base(config.export_mat_file);
+        for (Eigen::Index j = 0; j < k; ++j) {
+            std::filesystem::path file = base;
+            file.replace_filename(base.stem().string() + "_rhs" + std::to_string(j) + base.extension().string());
+            exportResult(config, results[j], file.string(), out);
+        }
+    }
+
+    return all_converged ? 0 : 2;  // Exit code 2 for non-convergence (not an error)
+}
+
+// Solve with an already loaded matrix (full or symmetric storage)
+// Inner = void runs plain CG in T; otherwise iterative refinement with an Inner CG
+template<typename T, typename Inner, typename MatrixType>
+int solveWithMatrix(const SolverConfig& config, const MatrixType& A, std::ostream& out) {
+    using VectorType = typename bailey::PrecisionTraits<T>::vector_type;
     int n = A.rows();
     
-    std::cout << "Matrix size: " << n << " x " << A.cols() << std::endl;
-    std::cout << "Non-zeros: " << A.nonZeros() << std::endl;
-    
     // Calculate max iterations
     int max_iterations = algorithms::resolve_max_iterations(config.max_iter, n);
     
-    std::cout << "Max iterations: " << max_iterations << std::endl;
-    std::cout << std::scientific << std::setprecision(2) << "Tolerance: " << config.tolerance << std::endl;
+    out << "Max iterations: " << max_iterations << std::endl;
+    out << std::scientific << std::setprecision(2) << "Tolerance: " << config.tolerance << std::endl;
+    out << "Diagnostics: " << algorithms::to_string(config.diagnostics.mode);
+    if (config.diagnostics.records_error() && config.diagnostics.interval > 1) {
+        out << " (error norms every " << config.diagnostics.interval << " iterations)";
+    }
+    out << std::endl;
+    if constexpr (!std::is_void_v<Inner>) {
+        out << "Iterative refinement: inner CG in " << bailey::PrecisionTraits<Inner>::name()
+                  << " (tol " << config.refinement.inner_tolerance << "), max "
+                  << config.refinement.max_outer << " outer steps" << std::endl;
+    }
+#ifdef BAILEY_DD_SOA
+    if constexpr (std::is_same_v<T, bailey::DDNumber>) {
+        out << "DD SIMD kernels: " << bailey::dd_simd::isa_name(bailey::dd_simd::active_isa()) << std::endl;
+    }
+#endif
+    
+    if constexpr (std::is_void_v<Inner>) {
+        if (config.nrhs > 1) {
+            return solveMultiRhs<T>(config, A, max_iterations, out);
+        }
+    }
     
     // Set up problem: Ax = b where x_true = ones(n)
     VectorType x_true = VectorType::Ones(n);
-    VectorType b = A * x_true;
+    VectorType b(n);
+    algorithms::kernels::spmv<T>(A, x_true, b);
     VectorType x = VectorType::Zero(n);  // Initial guess
     
-    std::cout << "\nStarting CG iterations...\n";
+    // Checkpoint/restart (classic CG only, see validateConfig)
+    algorithms::CheckpointPolicy<T> checkpoint;
+    std::optional<algorithms::CGState<T>> resume_state;
+    if (!config.resume_file.empty()) {
+        resume_state = io::readCheckpoint<T>(resolveExportPath(config.resume_file), b);
+        // Reject before the history stream below is cut back to the checkpoint's offset
+        if (!resume_state->resumable_with(config.diagnostics, !config.history_stream_file.empty())) {
+            throw std::runtime_error("Checkpoint " + resolveExportPath(config.resume_file) +
+                                     " was written with different --diagnostics, --diag-every or --history-stream settings");
+        }
+        checkpoint.resume = &*resume_state;
+        out << "Resuming from " << resolveExportPath(config.resume_file) << " at iteration "
+            << resume_state->iteration << std::endl;
+    }
+    
+    // Stream the convergence history to a file instead of keeping it in memory
+    // (a resumed solve appends to the stream at the checkpoint's history offset)
+    algorithms::DiagnosticsPolicy diagnostics = config.diagnostics;
+    std::unique_ptr<io::HistoryStream> history;
+    if (!config.history_stream_file.empty()) {
+        std::optional<std::size_t> resume_at;
+        if (resume_state) {
+            resume_at = resume_state->progress.history_entries;
+        }
+        history = std::make_unique<io::HistoryStream>(resolveExportPath(config.history_stream_file), resume_at);
+        diagnostics.sink = history.get();
+    }
+    
+    // Checkpoints are committed only once the stream holds their history offset on disk
+    std::unique_ptr<io::CheckpointWriter<T>> checkpoint_writer;
+    if (!config.checkpoint_file.empty()) {
+        checkpoint_writer = std::make_unique<io::CheckpointWriter<T>>(resolveExportPath(config.checkpoint_file), b,
+                                                                      history.get());
+        checkpoint.sink = checkpoint_writer.get();
+        checkpoint.interval = config.checkpoint_interval;
+    }
+    
+    algorithms::CGResult<T> result;
+    if constexpr (std::is_void_v<Inner>) {
+        if (config.preconditioner != algorithms::PreconditionerType::None) {
+            result = solvePreconditioned<T>(config, A, b, x, x_true, max_iterations, diagnostics, out);
+        } else if (config.algorithm == "pipelined") {
+            out << "\nStarting pipelined CG iterations...\n";
+            result = algorithms::pipelinedConjugateGradient<T, MatrixType>(A, b, x, x_true, max_iterations,
+                                                                           config.tolerance, diagnostics);
+        } else if (config.algorithm == "sstep") {
+            out << "\nStarting s-step CG iterations (s = " << config.sstep << ")...\n";
+            result = algorithms::sstepConjugateGradient<T, MatrixType>(A, b, x, x_true, config.sstep, max_iterations,
+                                                                       config.tolerance, diagnostics);
+        } else {
+            out << "\nStarting CG iterations...\n";
+            result = algorithms::conjugateGradient<T, MatrixType>(A, b, x, x_true, max_iterations,
+                                                                  config.tolerance, diagnostics, checkpoint);
+        }
+    } else {
+        out << "\nStarting CG iterations...\n";
+        result = algorithms::iterativeRefinement<T, Inner, MatrixType>(A, b, x, x_true, max_iterations,
+                                                                       config.tolerance, config.refinement,
+                                                                       diagnostics);
+    }
     
-    auto result = algorithms::conjugateGradient<T>(A, b, x, x_true, max_iterations, config.tolerance);
+    // The last checkpoint syncs the stream, so the checkpoint writer closes first
+    if (checkpoint_writer) {
+        checkpoint_writer->close();
+    }
+    if (history) {
+        history->close();
+    }
     
     // Print results
-    algorithms::print_results(result, config.matrix_name + ".mtx");
+    algorithms::print_results(result, config.matrix_name + ".mtx", out);
+    if (history) {
+        out << "History stream: " << history->entries() << " entries written to " << history->path() << std::endl;
+    }
+    if (checkpoint_writer) {
+        out << "Checkpoints: " << checkpoint_writer->written() << " written to " << checkpoint_writer->path();
+        if (checkpoint_writer->last_iteration() >= 0) {
+            out << " (last at iteration " << checkpoint_writer->last_iteration() << ")";
+        }
+        out << std::endl;
+    }
     
     // Export to MATLAB .mat file if requested
     if (!config.export_mat_file.empty()) {
-#ifdef ENABLE_MAT_EXPORT
-        std::string export_path = resolveExportPath(config.export_mat_file);
-        std::cout << "\nExporting convergence data to " << export_path << "..." << std::endl;
-        bool export_success = io::MatExporter::export_convergence_data(
-            result, 
-            export_path, 
-            config.matrix_name, 
-            config.precision_level
-        );
-        if (export_success) {
-            std::cout << "Export successful." << std::endl;
-        } else {
-            std::cerr << "Warning: Export failed." << std::endl;
-        }
-#else
-        std::cerr << "Warning: MATLAB export not available - built without matio-cpp support." << std::endl;
-#endif
+        exportResult(config, result, config.export_mat_file, out);
     }
     
     return result.converged ? 0 : 2;  // Exit code 2 for non-convergence (not an error)
 }
 
-// Solver dispatcher using std::variant
-int runSolver(const SolverConfig& config) {
-    if (config.precision_level == "dd") {
-        return solveCG<bailey::DDNumber>(config);
-    } else if (config.precision_level == "dq") {
-        return solveCG<bailey::DQNumber>(config);
-    } else if (config.precision_level == "qx") {
-        return solveCG<bailey::QXNumber>(config);
-    } else if (config.precision_level == "double") {
-        return solveCG<double>(config);
+// Template solver function: load the matrix in the configured storage and solve
+template<typename T, typename Inner = void>
+int solveCG(const SolverConfig& config) {
+    using Traits = bailey::PrecisionTraits<T>;
+    
+    std::string matrix_path = io::constructMatrixPath(config.matrix_name, config.input_dir);
+    
+    std::cout << "Loading matrix: " << matrix_path << " (precision: " << Traits::name() << ")" << std::endl;
+    
+    // Load, report size/memory/time, then solve
+    auto solve = [&](auto load) {
+        auto load_start = std::chrono::high_resolution_clock::now();
+        io::MatrixSource source;
+        const auto A = load(&source);
+        auto load_end = std::chrono::high_resolution_clock::now();
+        double load_time = std::chrono::duration<double>(load_end - load_start).count();
+        using Value = typename std::decay_t<decltype(A)>::Scalar;
+        
+        std::cout << "Matrix size: " << A.rows() << " x " << A.cols() << std::endl;
+        std::cout << "Non-zeros: " << A.nonZeros() << std::endl;
+        std::cout << "Storage: " << config.matrix_storage
+                  << (std::is_same_v<Value, T> ? "" : ", double values") << " ("
+                  << std::fixed << std::setprecision(1) << matrixBytes(A) / 1048576.0 << " MiB)" << std::endl;
+        std::cout << std::setprecision(3) << "Load time[s]: " << load_time
+                  << (source == io::MatrixSource::Cache ? " (binary cache)" : "") << std::endl;
+        
+        return solveWithMatrix<T, Inner>(config, A, std::cout);
+    };
+    
+    // Values stay in double (mixed storage) or are converted to T once at load
+    auto solve_storage = [&](auto value_tag) {
+        using Value = typename decltype(value_tag)::type;
+        if (config.matrix_storage == "symmetric") {
+            return solve([&](io::MatrixSource* source) {
+                return io::loadSymmetricMatrixMarket<Value>(matrix_path, config.use_matrix_cache, source);
+            });
+        }
+        return solve([&](io::MatrixSource* source) {
+            return io::loadMatrixMarket<Value>(matrix_path, config.use_matrix_cache, source);
+        });
+    };
+    
+    if constexpr (!std::is_same_v<T, double>) {
+        if (config.matrix_values == "double") {
+            return solve_storage(std::type_identity<double>{});
+        }
+    }
+    return solve_storage(std::type_identity<T>{});
+}
+
+// Resolve the precision level (and --inner-precision for *-ir levels) through the
+// registries and call f(std::type_identity<T>{}, std::type_identity<Inner>{}),
+// Inner = void for plain CG in T; returns f's exit code
+template<typename F>
+int dispatchPrecision(const SolverConfig& config, F&& f) {
+    std::string_view key = config.precision_level;
+    int status = 1;
+    bool found = false;
+    if (key.ends_with(refinement_suffix)) {
+        key.remove_suffix(refinement_suffix.size());
+        found = RefinedPrecisions::dispatch(key, [&](auto outer) {
+            bool inner_found = InnerPrecisions::dispatch(config.inner_precision, [&](auto inner) {
+                status = f(outer, inner);
+            });
+            if (!inner_found) {
+                throw std::runtime_error("Invalid inner precision: " + config.inner_precision);
+            }
+        });
     } else {
-        std::cerr << "Invalid precision level: " << config.precision_level << std::endl;
-        return 1;
+        found = SolverPrecisions::dispatch(key, [&](auto type) {
+            status = f(type, std::type_identity<void>{});
+        });
+    }
+    if (!found) {
+        throw std::runtime_error("Invalid precision level: " + config.precision_level);
+    }
+    return status;
+}
+
+// Solver dispatcher: precision level -> solveCG<T, Inner>
+int runSolver(const SolverConfig& config) {
+    return dispatchPrecision(config, [&](auto type, auto inner) {
+        return solveCG<typename decltype(type)::type, typename decltype(inner)::type>(config);
+    });
+}
+
+// ==============================================================================
+//  Batch mode (--batch FILE)
+//
+//  Each job is one solve (matrix, precision, tol, max-iter, export file);
+//  all other options come from the command line and apply to every job.
+//  A matrix is loaded once, in double (full or symmetric storage per
+//  --storage), and shared read-only by all jobs on it: every precision
+//  runs on the double values with promotion inside SpMV, which gives the
+//  same results as native storage. It is released after its last job.
+//  Jobs run concurrently on --jobs worker threads; each job's output is
+//  buffered and printed as a whole when it finishes.
+// ==============================================================================
+
+struct BatchJob {
+    int line{0};  // Line number in the job file
+    SolverConfig config;
+};
+
+// Job file: one job per line, "matrix precision [tol [max-iter [export.mat]]]"
+// ('#' starts a comment; missing fields default to the command line; the
+// export file defaults to <matrix>_<precision>.mat, "-" disables export)
+std::vector<BatchJob> parseBatchFile(const SolverConfig& base) {
+    std::ifstream file(base.batch_file);
+    if (!file) {
+        throw std::runtime_error("Cannot open batch file: " + base.batch_file);
+    }
+
+    std::vector<BatchJob> jobs;
+    std::map<std::string, int> export_lines;  // Export file -> line of its job
+    std::string text;
+    for (int line = 1; std::getline(file, text); ++line) {
+        text = text.substr(0, text.find('#'));
+        std::istringstream fields(text);
+        std::vector<std::string> tokens;
+        for (std::string token; fields >> token;) {
+            tokens.push_back(token);
+        }
+        if (tokens.empty()) {
+            continue;
+        }
+
+        const std::string where = base.batch_file + ":" + std::to_string(line) + ": ";
+        if (tokens.size() < 2 || tokens.size() > 5) {
+            throw std::runtime_error(where + "expected: matrix precision [tol [max-iter [export.mat]]]");
+        }
+        BatchJob job;
+        job.line = line;
+        job.config = base;
+        job.config.batch_file.clear();
+        job.config.matrix_values = "double";
+        job.config.matrix_name = tokens[0];
+        job.config.precision_level = tokens[1];
+        job.config.export_mat_file = tokens[0] + "_" + tokens[1] + ".mat";
+        try {
+            validatePrecisionLevel(job.config.precision_level);
+            if (tokens.size() > 2) {
+                try {
+                    job.config.tolerance = std::stod(tokens[2]);
+                } catch (...) {
+                    throw std::runtime_error("Invalid tolerance value");
+                }
+            }
+            if (tokens.size() > 3) {
+                job.config.max_iter = parseMaxIter(tokens[3]);
+            }
+            if (tokens.size() > 4) {
+                job.config.export_mat_file = tokens[4] == "-" ? "" : tokens[4];
+            }
+            validateConfig(job.config);
+        } catch (const std::exception& e) {
+            throw std::runtime_error(where + e.what());
+        }
+
+        if (!job.config.export_mat_file.empty()) {
+            auto [it, inserted] = export_lines.emplace(job.config.export_mat_file, line);
+            if (!inserted) {
+                throw std::runtime_error(where + "export file " + job.config.export_mat_file +
+                                         " is also written by line " + std::to_string(it->second));
+            }
+        }
+        jobs.push_back(std::move(job));
     }
+    if (jobs.empty()) {
+        throw std::runtime_error("No jobs in batch file: " + base.batch_file);
+    }
+    return jobs;
+}
+
+// Solve one batch job with its shared double-valued matrix
+template<typename MatrixType>
+int solveJob(const SolverConfig& config, const MatrixType& A, std::ostream& out) {
+    return dispatchPrecision(config, [&](auto type, auto inner) {
+        return solveWithMatrix<typename decltype(type)::type, typename decltype(inner)::type>(config, A, out);
+    });
+}
+
+// Run all jobs on a pool of worker threads, loading each matrix once
+template<typename MatrixType, typename Load>
+int runBatchJobs(const SolverConfig& base, const std::vector<BatchJob>& jobs, Load load) {
+    struct SharedMatrix {
+        std::once_flag loaded;
+        std::shared_ptr<const MatrixType> A;
+        double load_time{0.0};
+        io::MatrixSource source{};
+        int remaining{0};  // Jobs not yet finished (released at zero)
+    };
+    std::map<std::string, SharedMatrix> matrices;
+    for (const auto& job : jobs) {
+        ++matrices[job.config.matrix_name].remaining;
+    }
+
+    const int hardware = static_cast<int>(std::max(1u, std::thread::hardware_concurrency()));
+    const int workers = std::min<int>(base.batch_workers > 0 ? base.batch_workers : hardware,
+                                      static_cast<int>(jobs.size()));
+    int kernel_threads = 1;
+#ifdef _OPENMP
+    kernel_threads = std::max(1, omp_get_max_threads() / workers);
+#endif
+
+    std::cout << "Batch: " << jobs.size() << " jobs on " << matrices.size() << " matrices from "
+              << base.batch_file << std::endl;
+    std::cout << "Workers: " << workers << " (" << kernel_threads << " kernel threads each)" << std::endl;
+    std::cout << "Storage: " << base.matrix_storage << ", double values (shared by all precisions)" << std::endl;
+
+    std::vector<int> status(jobs.size(), 1);
+    std::vector<double> wall_time(jobs.size(), 0.0);
+    std::vector<std::string> error(jobs.size());
+    std::atomic<std::size_t> next{0};
+    std::mutex mutex;  // Guards SharedMatrix::remaining/A release and std::cout
+
+    auto batch_start = std::chrono::high_resolution_clock::now();
+    auto worker = [&] {
+#ifdef _OPENMP
+        omp_set_num_threads(kernel_threads);
+#endif
+        for (std::size_t j = next++; j < jobs.size(); j = next++) {
+            const SolverConfig& config = jobs[j].config;
+            SharedMatrix& shared = matrices.at(config.matrix_name);
+            std::ostringstream out;
+            out << "\n===== Job " << j + 1 << "/" << jobs.size() << " (line " << jobs[j].line << "): "
+                << config.matrix_name << ", " << config.precision_level << " =====" << std::endl;
+
+            auto job_start = std::chrono::high_resolution_clock::now();
+            try {
+                std::call_once(shared.loaded, [&] {
+                    auto load_start = std::chrono::high_resolution_clock::now();
+                    shared.A = std::make_shared<const MatrixType>(
+                        load(io::constructMatrixPath(config.matrix_name, config.input_dir), &shared.source));
+                    shared.load_time = std::chrono::duration<double>(
+                        std::chrono::high_resolution_clock::now() - load_start).count();
+                });
+                std::shared_ptr<const MatrixType> A;
+                {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    A = shared.A;
+                }
+                out << "Matrix size: " << A->rows() << " x " << A->cols() << ", non-zeros: " << A->nonZeros()
+                    << std::fixed << std::setprecision(3) << ", load time[s]: " << shared.load_time
+                    << (shared.source == io::MatrixSource::Cache ? " (binary cache)" : "") << std::endl;
+                status[j] = solveJob(config, *A, out);
+            } catch (const std::exception& e) {
+                error[j] = e.what();
+                out << "Error: " << error[j] << std::endl;
+            }
+            wall_time[j] = std::chrono::duration<double>(
+                std::chrono::high_resolution_clock::now() - job_start).count();
+
+            std::lock_guard<std::mutex> lock(mutex);
+            if (--shared.remaining == 0) {
+                shared.A.reset();
+            }
+            std::cout << out.str() << std::flush;
+        }
+    };
+
+    std::vector<std::thread> pool;
+    for (int w = 1; w < workers; ++w) {
+        pool.emplace_back(worker);
+    }
+    worker();
+    for (auto& thread : pool) {
+        thread.join();
+    }
+    double batch_time = std::chrono::duration<double>(
+        std::chrono::high_resolution_clock::now() - batch_start).count();
+
+    // Summary; exit code 1 if any job failed, else 2 if any did not converge
+    int exit_code = 0;
+    std::cout << "\n===== Batch summary =====" << std::endl;
+    for (std::size_t j = 0; j < jobs.size(); ++j) {
+        const SolverConfig& config = jobs[j].config;
+        std::string result = status[j] == 0 ? "converged" : status[j] == 2 ? "NOT converged" : "FAILED: " + error[j];
+        std::cout << std::setw(4) << j + 1 << "  " << std::left << std::setw(16) << config.matrix_name
+                  << std::setw(8) << config.precision_level << std::right << std::fixed << std::setprecision(3)
+                  << std::setw(10) << wall_time[j] << " s  " << result << std::endl;
+        if (status[j] == 1) {
+            exit_code = 1;
+        } else if (status[j] == 2 && exit_code == 0) {
+            exit_code = 2;
+        }
+    }
+    std::cout << "Batch time[s]: " << std::fixed << std::setprecision(3) << batch_time << std::endl;
+    return exit_code;
+}
+
+// Batch mode entry point: parse the job file and run it in the configured storage
+int runBatch(const SolverConfig& config) {
+    const auto jobs = parseBatchFile(config);
+    if (config.matrix_storage == "symmetric") {
+        return runBatchJobs<bailey::SymmetricCsrMatrix<double>>(config, jobs,
+            [&](const std::string& path, io::MatrixSource* source) {
+                return io::loadSymmetricMatrixMarket<double>(path, config.use_matrix_cache, source);
+            });
+    }
+    return runBatchJobs<bailey::PrecisionTraits<double>::matrix_type>(config, jobs,
+        [&](const std::string& path, io::MatrixSource* source) {
+            return io::loadMatrixMarket<double>(path, config.use_matrix_cache, source);
+        });
 }
 
 int main(int argc, char* argv[]) {
     try {
         SolverConfig config = parseCommandLine(argc, argv);
+        if (!config.batch_file.empty()) {
+            return runBatch(config);
+        }
         return runSolver(config);
     } catch (const std::exception& e) {
         std::string error_msg = e.what();
@@ -0,0 +1,61 @@
+#include <iostream>
+#include <iomanip>
+#include <random>
+#include <cstring>
+#include "bailey/dd_arithmetic.hpp"
+
+// Compare the header-only DD kernels against DDFUN bit-for-bit
+// on random operands spanning several orders of magnitude.
+
+namespace {
+
+bool same_bits(const double* x, const double* y) {
+    return std::memcmp(x, y, 2 * sizeof(double)) == 0;
+}
+
+} // namespace
+
+int main() {
+    namespace k = bailey::dd_kernels;
+
+    std::mt19937_64 rng(12345);
+    std::uniform_real_distribution<double> mant(-1.0, 1.0);
+    std::uniform_int_distribution<int> expo(-30, 30);
+
+    auto random_dd = [&](double* v) {
+        double hi = std::ldexp(mant(rng), expo(rng));
+        double lo = std::ldexp(mant(rng), std::ilogb(hi == 0.0 ? 1.0 : hi) - 54);
+        // Normalize so (v[0], v[1]) is a valid DD pair
+        v[0] = hi + lo;
+        v[1] = lo - (v[0] - hi);
+    };
+
+    const int samples = 100000;
+    int mismatch[6] = {0, 0, 0, 0, 0, 0};
+
+    for (int i = 0; i < samples; ++i) {
+        double a[2], b[2], ref[2], got[2];
+        random_dd(a);
+        random_dd(b);
+
+        ddadd_(a, b, ref);  k::add(a, b, got);  mismatch[0] += !same_bits(ref, got);
+        ddsub_(a, b, ref);  k::sub(a, b, got);  mismatch[1] += !same_bits(ref, got);
+        ddmul_(a, b, ref);  k::mul(a, b, got);  mismatch[2] += !same_bits(ref, got);
+        dddiv_(a, b, ref);  k::div(a, b, got);  mismatch[3] += !same_bits(ref, got);
+        ddmuld_(a, &b[0], ref);  k::mul_d(a, b[0], got);  mismatch[5] += !same_bits(ref, got);
+
+        a[0] = std::abs(a[0]);
+        a[1] = a[0] == 0.0 ? 0.0 : a[1];
+        ddsqrt_(a, ref);    k::sqrt(a, got);    mismatch[4] += !same_bits(ref, got);
+    }
+
+    const char* names[6] = {"add", "sub", "mul", "div", "sqrt", "muld"};
+    int total = 0;
+    std::cout << "=== DD inline kernels vs DDFUN (" << samples << " samples) ===" << std::endl;
+    for (int i = 0; i < 6; ++i) {
+        std::cout << std::setw(5) << names[i] << ": " << mismatch[i] << " mismatches" << std::endl;
+        total += mismatch[i];
+    }
+
+    return total == 0 ? 0 : 1;
+}
@@ -0,0 +1,9 @@
+#include "algorithms/cg_instantiations.hpp"
+
+// Explicit instantiation of the CG solvers in DD precision (see cg_instantiations.hpp)
+
+namespace algorithms {
+
+BAILEY_CG_INSTANCES(, bailey::DDNumber)
+
+} // namespace algorithms
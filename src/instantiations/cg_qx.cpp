@@ -0,0 +1,9 @@
+#include "algorithms/cg_instantiations.hpp"
+
+// Explicit instantiation of the CG solvers in QX precision (see cg_instantiations.hpp)
+
+namespace algorithms {
+
+BAILEY_CG_INSTANCES(, bailey::QXNumber)
+
+} // namespace algorithms
@@ -0,0 +1,65 @@
+#include <iostream>
+#include <iomanip>
+#include <random>
+#include <cstring>
+#include "bailey/qx_arithmetic.hpp"
+
+// Compare the header-only QX kernels against QXFUN bit-for-bit
+// on random operands spanning several orders of magnitude.
+
+namespace {
+
+bool same_bits(long double x, long double y) {
+    return std::memcmp(&x, &y, sizeof(long double)) == 0;
+}
+
+} // namespace
+
+int main() {
+    namespace k = bailey::qx_kernels;
+
+    if (!k::long_double_is_binary128) {
+        std::cerr << "long double is not IEEE binary128 (see check_ldbl); QX kernels do not apply" << std::endl;
+        return 1;
+    }
+
+    std::mt19937_64 rng(12345);
+    std::uniform_real_distribution<double> mant(-1.0, 1.0);
+    std::uniform_int_distribution<int> expo(-30, 30);
+
+    // Full 113-bit significands: a leading double (53 bits) plus 60 random
+    // bits right below its last bit, built in long double so they are exact
+    auto random_qx = [&]() {
+        long double hi = std::ldexp(static_cast<long double>(mant(rng)), expo(rng));
+        long double bits = std::ldexp(static_cast<long double>(rng() >> 4), -60);  // 60 bits in [0, 1)
+        long double lo = std::ldexp(bits, std::ilogb(hi == 0.0L ? 1.0L : hi) - 52);
+        return (rng() & 1) ? hi - lo : hi + lo;
+    };
+
+    const int samples = 100000;
+    int mismatch[5] = {0, 0, 0, 0, 0};
+
+    for (int i = 0; i < samples; ++i) {
+        long double a = random_qx();
+        long double b = random_qx();
+        long double ref;
+
+        qxadd_(&a, &b, &ref);  mismatch[0] += !same_bits(ref, k::add(a, b));
+        qxsub_(&a, &b, &ref);  mismatch[1] += !same_bits(ref, k::sub(a, b));
+        qxmul_(&a, &b, &ref);  mismatch[2] += !same_bits(ref, k::mul(a, b));
+        qxdiv_(&a, &b, &ref);  mismatch[3] += !same_bits(ref, k::div(a, b));
+
+        a = std::abs(a);
+        qxsqrt_(&a, &ref);     mismatch[4] += !same_bits(ref, k::sqrt(a));
+    }
+
+    const char* names[5] = {"add", "sub", "mul", "div", "sqrt"};
+    int total = 0;
+    std::cout << "=== QX inline kernels vs QXFUN (" << samples << " samples) ===" << std::endl;
+    for (int i = 0; i < 5; ++i) {
+        std::cout << std::setw(5) << names[i] << ": " << mismatch[i] << " mismatches" << std::endl;
+        total += mismatch[i];
+    }
+
+    return total == 0 ? 0 : 1;
+}
@@ -1,6 +1,7 @@
 #include "bailey/qx_arithmetic.hpp"
 #include "io/matrix_market.hpp"
 #include <iostream>
+#include <sstream>
 
 int main() {
     std::cout << "=== Simple Matrix Market Test ===" << std::endl;